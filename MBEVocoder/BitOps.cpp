@@ -0,0 +1,288 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/**
+* Digital Voice Modem - MBE Vocoder
+* GPLv2 Open Source. Use is subject to license terms.
+* DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+*
+* @package DVM / MBE Vocoder
+* @license GPLv2 License (https://opensource.org/licenses/GPL-2.0)
+*
+*/
+#include "BitOps.h"
+
+#include <cstdio>
+#include <cassert>
+#include <cstring>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define BITOPS_X64
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#include <immintrin.h>
+#endif
+
+#if defined(BITOPS_X64) && (defined(__GNUC__) || defined(__clang__))
+#define BITOPS_TARGET(x) __attribute__((target(x)))
+#else
+#define BITOPS_TARGET(x)
+#endif
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/// <summary>
+/// Returns a mask of the low n bits, for n of 0 to 64.
+/// </summary>
+/// <param name="n"></param>
+/// <returns></returns>
+static inline uint64_t lowMask(uint32_t n)
+{
+    return (n >= 64U) ? ~0ULL : ((1ULL << n) - 1ULL);
+}
+
+/// <summary>
+/// Loads 8 bytes as a big endian word.
+/// </summary>
+/// <param name="p"></param>
+/// <returns></returns>
+static inline uint64_t loadBE64(const uint8_t* p)
+{
+    uint64_t w;
+    ::memcpy(&w, p, sizeof(w));
+#if defined(_MSC_VER)
+    return _byteswap_uint64(w);
+#elif defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    return __builtin_bswap64(w);
+#elif defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    return w;
+#else
+    w = 0U;
+    for (uint32_t i = 0U; i < 8U; i++)
+        w = (w << 8) | p[i];
+    return w;
+#endif
+}
+
+/// <summary>
+/// Stores a word as 8 big endian bytes.
+/// </summary>
+/// <param name="p"></param>
+/// <param name="w"></param>
+static inline void storeBE64(uint8_t* p, uint64_t w)
+{
+#if defined(_MSC_VER)
+    w = _byteswap_uint64(w);
+    ::memcpy(p, &w, sizeof(w));
+#elif defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    w = __builtin_bswap64(w);
+    ::memcpy(p, &w, sizeof(w));
+#elif defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    ::memcpy(p, &w, sizeof(w));
+#else
+    for (uint32_t i = 0U; i < 8U; i++)
+        p[i] = (uint8_t)(w >> (56U - (i * 8U)));
+#endif
+}
+
+/// <summary>
+/// Portable popcount.
+/// </summary>
+/// <param name="x"></param>
+/// <returns></returns>
+static uint32_t popcount64Sw(uint64_t x)
+{
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (uint32_t)((x * 0x0101010101010101ULL) >> 56);
+}
+
+#if defined(BITOPS_X64)
+/// <summary>
+/// Hardware popcount.
+/// </summary>
+/// <param name="x"></param>
+/// <returns></returns>
+BITOPS_TARGET("popcnt") static uint32_t popcount64Hw(uint64_t x)
+{
+    return (uint32_t)_mm_popcnt_u64(x);
+}
+#endif // defined(BITOPS_X64)
+
+/// <summary>
+/// Checks whether the CPU supports the popcount instruction.
+/// </summary>
+/// <returns></returns>
+static bool cpuHasPopcount()
+{
+#if defined(BITOPS_X64) && defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] & (1 << 23)) != 0;
+#elif defined(BITOPS_X64) && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("popcnt") != 0;
+#else
+    return false;
+#endif
+}
+
+// The dispatch pointer starts at a resolver that picks the implementation on first
+// use and replaces itself; concurrent first calls all store the same value.
+
+static uint32_t popcount64Resolve(uint64_t x);
+
+static uint32_t (*volatile popcount64Fn)(uint64_t) = popcount64Resolve;
+
+/// <summary>
+/// Selects the popcount implementation.
+/// </summary>
+/// <param name="x"></param>
+/// <returns></returns>
+static uint32_t popcount64Resolve(uint64_t x)
+{
+#if defined(BITOPS_X64)
+    popcount64Fn = cpuHasPopcount() ? popcount64Hw : popcount64Sw;
+#else
+    popcount64Fn = popcount64Sw;
+#endif
+    return popcount64Fn(x);
+}
+
+/// <summary>
+/// Reads up to 64 bits from a bit position in a buffer, right aligned.
+/// </summary>
+/// <remarks>Only the bytes holding the requested bits are read.</remarks>
+/// <param name="in">Buffer to read from.</param>
+/// <param name="start">Bit position of the first (most significant) bit.</param>
+/// <param name="length">Number of bits; 0 to 64.</param>
+/// <returns></returns>
+static uint64_t readBits(const uint8_t* in, uint32_t start, uint32_t length)
+{
+    assert(in != NULL);
+    assert(length <= 64U);
+
+    if (length == 0U)
+        return 0U;
+
+    uint32_t first = start >> 3;
+    uint32_t last = (start + length - 1U) >> 3;
+
+    // a range spanning 9 bytes is read as two halves
+    if (last - first >= 8U) {
+        uint64_t hi = readBits(in, start, 32U);
+        return (hi << (length - 32U)) | readBits(in, start + 32U, length - 32U);
+    }
+
+    uint64_t w = 0U;
+    for (uint32_t i = first; i <= last; i++)
+        w = (w << 8) | in[i];
+
+    return (w >> (((last + 1U) << 3) - (start + length))) & lowMask(length);
+}
+
+/// <summary>
+/// Writes up to 64 right aligned bits to a bit position in a buffer.
+/// </summary>
+/// <remarks>Only the bytes holding the written bits are touched; other bits in them are preserved.</remarks>
+/// <param name="out">Buffer to write to.</param>
+/// <param name="start">Bit position of the first (most significant) bit.</param>
+/// <param name="length">Number of bits; 0 to 64.</param>
+/// <param name="value">Bits to write.</param>
+static void writeBits(uint8_t* out, uint32_t start, uint32_t length, uint64_t value)
+{
+    assert(out != NULL);
+    assert(length <= 64U);
+
+    if (length == 0U)
+        return;
+
+    uint32_t first = start >> 3;
+    uint32_t last = (start + length - 1U) >> 3;
+
+    // a range spanning 9 bytes is written as two halves
+    if (last - first >= 8U) {
+        writeBits(out, start, 32U, value >> (length - 32U));
+        writeBits(out, start + 32U, length - 32U, value);
+        return;
+    }
+
+    uint32_t shift = ((last + 1U) << 3) - (start + length);
+    uint64_t mask = lowMask(length) << shift;
+
+    uint64_t w = 0U;
+    for (uint32_t i = first; i <= last; i++)
+        w = (w << 8) | out[i];
+
+    w = (w & ~mask) | ((value << shift) & mask);
+
+    for (uint32_t i = last + 1U; i > first; i--, w >>= 8)
+        out[i - 1U] = (uint8_t)w;
+}
+
+// ---------------------------------------------------------------------------
+//  Static Class Members
+// ---------------------------------------------------------------------------
+
+/// <summary>
+/// Copies a range of bits between two non-overlapping buffers.
+/// </summary>
+/// <param name="in">Buffer to copy from.</param>
+/// <param name="inStart">Bit position of the first bit to copy.</param>
+/// <param name="out">Buffer to copy to.</param>
+/// <param name="outStart">Bit position to copy the first bit to.</param>
+/// <param name="length">Number of bits to copy.</param>
+void BitOps::copyBits(const uint8_t* in, uint32_t inStart, uint8_t* out, uint32_t outStart, uint32_t length)
+{
+    assert(in != NULL);
+    assert(out != NULL);
+
+    // byte aligned on both sides, copy whole bytes directly
+    if (((inStart | outStart) & 7U) == 0U && length >= 8U) {
+        uint32_t bytes = length >> 3;
+        ::memcpy(out + (outStart >> 3), in + (inStart >> 3), bytes);
+        inStart += bytes << 3;
+        outStart += bytes << 3;
+        length -= bytes << 3;
+    }
+
+    // move 56 bits per step through 8 byte windows; while at least 64 bits remain both
+    // windows lie entirely inside the source and destination ranges
+    while (length >= 64U) {
+        uint64_t v = (loadBE64(in + (inStart >> 3)) << (inStart & 7U)) & 0xFFFFFFFFFFFFFF00ULL;
+
+        uint8_t* p = out + (outStart >> 3);
+        uint32_t s = outStart & 7U;
+        uint64_t mask = 0xFFFFFFFFFFFFFF00ULL >> s;
+        storeBE64(p, (loadBE64(p) & ~mask) | (v >> s));
+
+        inStart += 56U;
+        outStart += 56U;
+        length -= 56U;
+    }
+
+    while (length > 0U) {
+        uint32_t n = (length < 56U) ? length : 56U;
+        writeBits(out, outStart, n, readBits(in, inStart, n));
+
+        inStart += n;
+        outStart += n;
+        length -= n;
+    }
+}
+
+// ---------------------------------------------------------------------------
+//  Private Static Class Members
+// ---------------------------------------------------------------------------
+
+/// <summary>
+/// Returns the count of set bits using the implementation selected for the CPU.
+/// </summary>
+/// <param name="x"></param>
+/// <returns></returns>
+uint32_t BitOps::popcount(uint64_t x)
+{
+    return popcount64Fn(x);
+}
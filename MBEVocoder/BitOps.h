@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/**
+* Digital Voice Modem - MBE Vocoder
+* GPLv2 Open Source. Use is subject to license terms.
+* DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+*
+* @package DVM / MBE Vocoder
+* @license GPLv2 License (https://opensource.org/licenses/GPL-2.0)
+*
+*/
+#if !defined(__BIT_OPS_H__)
+#define __BIT_OPS_H__
+
+#include "Defines.h"
+
+// popcount is inlined when the compiler may assume the instruction (MSVC implies it with /arch:AVX)
+#if defined(__POPCNT__) || (defined(_MSC_VER) && defined(__AVX__))
+#define BITOPS_INLINE_POPCOUNT
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+//      Implements word-wise bit manipulation. Bit positions within byte
+//      buffers are numbered MSB first, the same as READ_BIT/WRITE_BIT.
+//      Popcount is inlined when the build targets the instruction, and is
+//      otherwise selected once at runtime, with a portable fallback.
+// ---------------------------------------------------------------------------
+
+class HOST_SW_API BitOps {
+public:
+    /// <summary>Returns the count of set bits in the passed 32-bit value.</summary>
+    static __forceinline uint32_t popcount32(uint32_t x)
+    {
+#if defined(BITOPS_INLINE_POPCOUNT) && defined(_MSC_VER)
+        return __popcnt(x);
+#elif defined(BITOPS_INLINE_POPCOUNT)
+        return (uint32_t)__builtin_popcount(x);
+#else
+        return popcount(x);
+#endif
+    }
+    /// <summary>Returns the count of set bits in the passed 64-bit value.</summary>
+    static __forceinline uint32_t popcount64(uint64_t x)
+    {
+#if defined(BITOPS_INLINE_POPCOUNT) && defined(_MSC_VER) && defined(_M_X64)
+        return (uint32_t)__popcnt64(x);
+#elif defined(BITOPS_INLINE_POPCOUNT) && defined(_MSC_VER)
+        return __popcnt((uint32_t)x) + __popcnt((uint32_t)(x >> 32));
+#elif defined(BITOPS_INLINE_POPCOUNT)
+        return (uint32_t)__builtin_popcountll(x);
+#else
+        return popcount(x);
+#endif
+    }
+
+    /// <summary>Copies a range of bits between two non-overlapping buffers.</summary>
+    static void copyBits(const uint8_t* in, uint32_t inStart, uint8_t* out, uint32_t outStart, uint32_t length);
+
+private:
+    /// <summary>Returns the count of set bits using the implementation selected for the CPU.</summary>
+    static uint32_t popcount(uint64_t x);
+};
+
+#endif // __BIT_OPS_H__
@@ -123,8 +123,8 @@ inline std::string __FLOAT_STR(const float& value) {
 #define __FLOAT_ADDR(x)  (*(uint32_t*)& x)
 #define __DOUBLE_ADDR(x) (*(uint64_t*)& x)
 
-#define WRITE_BIT(p, i, b) p[(i) >> 3] = (b) ? (p[(i) >> 3] | BIT_MASK_TABLE[(i) & 7]) : (p[(i) >> 3] & ~BIT_MASK_TABLE[(i) & 7])
-#define READ_BIT(p, i)     (p[(i) >> 3] & BIT_MASK_TABLE[(i) & 7])
+#define WRITE_BIT(p, i, b) p[(i) >> 3] = (uint8_t)((p[(i) >> 3] & ~(0x80U >> ((i) & 7))) | ((uint32_t)(!!(b)) << (7 - ((i) & 7))))
+#define READ_BIT(p, i)     (p[(i) >> 3] & (0x80U >> ((i) & 7)))
 
 #define __SET_UINT32(val, buffer, offset)           \
             buffer[0U + offset] = val >> 24;        \
@@ -0,0 +1,321 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/**
+* Digital Voice Modem - MBE Vocoder
+* GPLv2 Open Source. Use is subject to license terms.
+* DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+*
+* @package DVM / MBE Vocoder
+* @license GPLv2 License (https://opensource.org/licenses/GPL-2.0)
+*
+*/
+#include "PCMOps.h"
+
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define PCM_OPS_SSE2
+#endif
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+static const float SAMPLE_SCALE = 32768.0f;
+static const float SAMPLE_MAX = 32767.0f;
+static const float SAMPLE_MIN = -32768.0f;
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/// <summary>
+/// Applies a gain to a 16-bit sample, clipping and truncating the result.
+/// </summary>
+/// <param name="sample"></param>
+/// <param name="gain"></param>
+/// <returns></returns>
+static inline int16_t gainSample(int16_t sample, float gain)
+{
+    float value = static_cast<float>(sample) * gain;
+    if (value > SAMPLE_MAX) {
+        value = SAMPLE_MAX;
+    }
+    else if (value < SAMPLE_MIN) {
+        value = SAMPLE_MIN;
+    }
+
+    return (int16_t)value;
+}
+
+/// <summary>
+/// Returns the largest absolute value of 16-bit samples.
+/// </summary>
+/// <param name="samples"></param>
+/// <param name="count"></param>
+/// <returns></returns>
+static int32_t peakSample(const int16_t* samples, uint32_t count)
+{
+    int32_t max = 0, min = 0;
+
+    uint32_t i = 0U;
+#if defined(PCM_OPS_SSE2)
+    __m128i vMax = _mm_setzero_si128(), vMin = _mm_setzero_si128();
+    for (; i + 8U <= count; i += 8U) {
+        __m128i s = _mm_loadu_si128((const __m128i*)(samples + i));
+        vMax = _mm_max_epi16(vMax, s);
+        vMin = _mm_min_epi16(vMin, s);
+    }
+
+    int16_t lanes[16U];
+    _mm_storeu_si128((__m128i*)lanes, vMax);
+    _mm_storeu_si128((__m128i*)(lanes + 8U), vMin);
+    for (uint32_t n = 0U; n < 8U; n++) {
+        if (lanes[n] > max)
+            max = lanes[n];
+        if (lanes[8U + n] < min)
+            min = lanes[8U + n];
+    }
+#endif
+    for (; i < count; i++) {
+        if (samples[i] > max)
+            max = samples[i];
+        if (samples[i] < min)
+            min = samples[i];
+    }
+
+    return (max > -min) ? max : -min;
+}
+
+#if defined(PCM_OPS_SSE2)
+/// <summary>
+/// Applies a gain to eight 16-bit samples, clipping and truncating the results.
+/// </summary>
+/// <remarks>The clipped values are in range, so the saturating pack only narrows them.</remarks>
+/// <param name="s"></param>
+/// <param name="gain"></param>
+/// <returns></returns>
+static inline __m128i gainSamples8(__m128i s, __m128 gain)
+{
+    const __m128 vMax = _mm_set1_ps(SAMPLE_MAX);
+    const __m128 vMin = _mm_set1_ps(SAMPLE_MIN);
+
+    // sign extend to 32-bit
+    __m128 lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16));
+    __m128 hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(s, s), 16));
+
+    lo = _mm_max_ps(_mm_min_ps(_mm_mul_ps(lo, gain), vMax), vMin);
+    hi = _mm_max_ps(_mm_min_ps(_mm_mul_ps(hi, gain), vMax), vMin);
+
+    return _mm_packs_epi32(_mm_cvttps_epi32(lo), _mm_cvttps_epi32(hi));
+}
+#endif
+
+// ---------------------------------------------------------------------------
+//  Static Class Members
+// ---------------------------------------------------------------------------
+
+/// <summary>
+/// Converts PCM bytes to 16-bit samples, applying a gain.
+/// </summary>
+/// <param name="in">16-bit little endian PCM bytes.</param>
+/// <param name="out">16-bit samples.</param>
+/// <param name="count">Number of samples.</param>
+/// <param name="gain"></param>
+void PCMOps::bytesToSamples(const uint8_t* in, int16_t* out, uint32_t count, float gain)
+{
+    assert(in != nullptr);
+    assert(out != nullptr);
+
+    uint32_t i = 0U;
+#if defined(PCM_OPS_SSE2)
+    // x86 is little endian, so the bytes load directly as samples
+    if (gain == 1.0f) {
+        ::memcpy(out, in, count * sizeof(int16_t));
+        return;
+    }
+
+    const __m128 vGain = _mm_set1_ps(gain);
+    for (; i + 8U <= count; i += 8U) {
+        __m128i s = _mm_loadu_si128((const __m128i*)(in + (i * 2U)));
+        _mm_storeu_si128((__m128i*)(out + i), gainSamples8(s, vGain));
+    }
+#endif
+    for (; i < count; i++) {
+        int16_t sample = (int16_t)(in[(i * 2U)] | (in[(i * 2U) + 1U] << 8));
+        out[i] = (gain == 1.0f) ? sample : gainSample(sample, gain);
+    }
+}
+
+/// <summary>
+/// Converts 16-bit samples to PCM bytes, applying a gain.
+/// </summary>
+/// <param name="in">16-bit samples.</param>
+/// <param name="out">16-bit little endian PCM bytes.</param>
+/// <param name="count">Number of samples.</param>
+/// <param name="gain"></param>
+void PCMOps::samplesToBytes(const int16_t* in, uint8_t* out, uint32_t count, float gain)
+{
+    assert(in != nullptr);
+    assert(out != nullptr);
+
+    uint32_t i = 0U;
+#if defined(PCM_OPS_SSE2)
+    if (gain == 1.0f) {
+        ::memcpy(out, in, count * sizeof(int16_t));
+        return;
+    }
+
+    const __m128 vGain = _mm_set1_ps(gain);
+    for (; i + 8U <= count; i += 8U) {
+        __m128i s = _mm_loadu_si128((const __m128i*)(in + i));
+        _mm_storeu_si128((__m128i*)(out + (i * 2U)), gainSamples8(s, vGain));
+    }
+#endif
+    for (; i < count; i++) {
+        int16_t sample = (gain == 1.0f) ? in[i] : gainSample(in[i], gain);
+        out[(i * 2U)] = (uint8_t)(sample & 0xFF);
+        out[(i * 2U) + 1U] = (uint8_t)((sample >> 8) & 0xFF);
+    }
+}
+
+/// <summary>
+/// Converts 16-bit samples to float samples, applying a gain.
+/// </summary>
+/// <param name="in">16-bit samples.</param>
+/// <param name="out">Float samples.</param>
+/// <param name="count">Number of samples.</param>
+/// <param name="gain"></param>
+void PCMOps::samplesToFloat(const int16_t* in, float* out, uint32_t count, float gain)
+{
+    assert(in != nullptr);
+    assert(out != nullptr);
+
+    uint32_t i = 0U;
+#if defined(PCM_OPS_SSE2)
+    const __m128 vScale = _mm_set1_ps(SAMPLE_SCALE);
+    const __m128 vGain = _mm_set1_ps(gain);
+    for (; i + 8U <= count; i += 8U) {
+        __m128i s = _mm_loadu_si128((const __m128i*)(in + i));
+        __m128 lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16));
+        __m128 hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(s, s), 16));
+
+        _mm_storeu_ps(out + i, _mm_mul_ps(_mm_div_ps(lo, vScale), vGain));
+        _mm_storeu_ps(out + i + 4U, _mm_mul_ps(_mm_div_ps(hi, vScale), vGain));
+    }
+#endif
+    for (; i < count; i++)
+        out[i] = (static_cast<float>(in[i]) / SAMPLE_SCALE) * gain;
+}
+
+/// <summary>
+/// Converts float samples to 16-bit samples, applying a gain.
+/// </summary>
+/// <remarks>Samples are clipped to +/-1.0 and scaled by 32767, as NAudio's SampleToWaveProvider16 does.</remarks>
+/// <param name="in">Float samples.</param>
+/// <param name="out">16-bit samples.</param>
+/// <param name="count">Number of samples.</param>
+/// <param name="gain"></param>
+void PCMOps::floatToSamples(const float* in, int16_t* out, uint32_t count, float gain)
+{
+    assert(in != nullptr);
+    assert(out != nullptr);
+
+    uint32_t i = 0U;
+#if defined(PCM_OPS_SSE2)
+    const __m128 vGain = _mm_set1_ps(gain);
+    const __m128 vOne = _mm_set1_ps(1.0f);
+    const __m128 vMinusOne = _mm_set1_ps(-1.0f);
+    const __m128 vMax = _mm_set1_ps(SAMPLE_MAX);
+    for (; i + 8U <= count; i += 8U) {
+        __m128 lo = _mm_mul_ps(_mm_loadu_ps(in + i), vGain);
+        __m128 hi = _mm_mul_ps(_mm_loadu_ps(in + i + 4U), vGain);
+        lo = _mm_mul_ps(_mm_max_ps(_mm_min_ps(lo, vOne), vMinusOne), vMax);
+        hi = _mm_mul_ps(_mm_max_ps(_mm_min_ps(hi, vOne), vMinusOne), vMax);
+
+        _mm_storeu_si128((__m128i*)(out + i), _mm_packs_epi32(_mm_cvttps_epi32(lo), _mm_cvttps_epi32(hi)));
+    }
+#endif
+    for (; i < count; i++) {
+        float value = in[i] * gain;
+        if (value > 1.0f) {
+            value = 1.0f;
+        }
+        else if (value < -1.0f) {
+            value = -1.0f;
+        }
+
+        out[i] = (int16_t)(value * SAMPLE_MAX);
+    }
+}
+
+/// <summary>
+/// Returns the peak level of 16-bit samples, scaled to 1.0.
+/// </summary>
+/// <param name="samples">16-bit samples.</param>
+/// <param name="count">Number of samples.</param>
+/// <returns>Largest absolute sample level.</returns>
+float PCMOps::peakLevel(const int16_t* samples, uint32_t count)
+{
+    assert(samples != nullptr);
+
+    return static_cast<float>(peakSample(samples, count)) / SAMPLE_SCALE;
+}
+
+/// <summary>
+/// Returns the peak and RMS level of 16-bit samples, scaled to 1.0.
+/// </summary>
+/// <param name="samples">16-bit samples.</param>
+/// <param name="count">Number of samples.</param>
+/// <param name="peak">Largest absolute sample level.</param>
+/// <param name="rms">Root mean square sample level.</param>
+void PCMOps::measureLevel(const int16_t* samples, uint32_t count, float& peak, float& rms)
+{
+    assert(samples != nullptr);
+
+    peak = 0.0f;
+    rms = 0.0f;
+    if (count == 0U)
+        return;
+
+    uint64_t sum = 0U;
+
+    uint32_t i = 0U;
+#if defined(PCM_OPS_SSE2)
+    // a pair of squares is at most 2^31, which fits the pmaddwd lanes read as unsigned
+    const __m128i zero = _mm_setzero_si128();
+    __m128i vSum = _mm_setzero_si128();
+    for (; i + 8U <= count; i += 8U) {
+        __m128i s = _mm_loadu_si128((const __m128i*)(samples + i));
+        __m128i sq = _mm_madd_epi16(s, s);
+        vSum = _mm_add_epi64(vSum, _mm_unpacklo_epi32(sq, zero));
+        vSum = _mm_add_epi64(vSum, _mm_unpackhi_epi32(sq, zero));
+    }
+
+    uint64_t lanes[2U];
+    _mm_storeu_si128((__m128i*)lanes, vSum);
+    sum = lanes[0U] + lanes[1U];
+#endif
+    for (; i < count; i++)
+        sum += (uint64_t)((int32_t)samples[i] * (int32_t)samples[i]);
+
+    peak = peakLevel(samples, count);
+    rms = static_cast<float>(::sqrt(static_cast<double>(sum) / static_cast<double>(count))) / SAMPLE_SCALE;
+}
+
+/// <summary>
+/// Returns true if the peak level of 16-bit samples exceeds the VOX threshold.
+/// </summary>
+/// <remarks>Matches comparing the largest absolute float sample, as NAudio's MeteringSampleProvider reports it.</remarks>
+/// <param name="samples">16-bit samples.</param>
+/// <param name="count">Number of samples.</param>
+/// <param name="threshold">VOX threshold, scaled to 1.0.</param>
+/// <returns></returns>
+bool PCMOps::detectVOX(const int16_t* samples, uint32_t count, float threshold)
+{
+    assert(samples != nullptr);
+
+    return peakLevel(samples, count) > threshold;
+}
@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/**
+* Digital Voice Modem - MBE Vocoder
+* GPLv2 Open Source. Use is subject to license terms.
+* DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+*
+* @package DVM / MBE Vocoder
+* @license GPLv2 License (https://opensource.org/licenses/GPL-2.0)
+*
+*/
+#if !defined(__PCM_OPS_H__)
+#define __PCM_OPS_H__
+
+#include "Defines.h"
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+//      Implements whole-buffer PCM sample conversion, gain and metering.
+//      PCM bytes are 16-bit little endian. Float samples are scaled to
+//      +/-1.0. Gain is applied as NAudio's VolumeWaveProvider16 does:
+//      scaled, clipped to 16-bit and truncated toward zero.
+// ---------------------------------------------------------------------------
+
+class HOST_SW_API PCMOps {
+public:
+    /// <summary>Converts PCM bytes to 16-bit samples, applying a gain.</summary>
+    static void bytesToSamples(const uint8_t* in, int16_t* out, uint32_t count, float gain = 1.0f);
+    /// <summary>Converts 16-bit samples to PCM bytes, applying a gain.</summary>
+    static void samplesToBytes(const int16_t* in, uint8_t* out, uint32_t count, float gain = 1.0f);
+
+    /// <summary>Converts 16-bit samples to float samples, applying a gain.</summary>
+    static void samplesToFloat(const int16_t* in, float* out, uint32_t count, float gain = 1.0f);
+    /// <summary>Converts float samples to 16-bit samples, applying a gain.</summary>
+    static void floatToSamples(const float* in, int16_t* out, uint32_t count, float gain = 1.0f);
+
+    /// <summary>Returns the peak level of 16-bit samples, scaled to 1.0.</summary>
+    static float peakLevel(const int16_t* samples, uint32_t count);
+    /// <summary>Returns the peak and RMS level of 16-bit samples, scaled to 1.0.</summary>
+    static void measureLevel(const int16_t* samples, uint32_t count, float& peak, float& rms);
+    /// <summary>Returns true if the peak level of 16-bit samples exceeds the VOX threshold.</summary>
+    static bool detectVOX(const int16_t* samples, uint32_t count, float threshold);
+};
+
+#endif // __PCM_OPS_H__
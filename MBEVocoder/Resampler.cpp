@@ -0,0 +1,347 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/**
+* Digital Voice Modem - MBE Vocoder
+* GPLv2 Open Source. Use is subject to license terms.
+* DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+*
+* @package DVM / MBE Vocoder
+* @license GPLv2 License (https://opensource.org/licenses/GPL-2.0)
+*
+*/
+#define _USE_MATH_DEFINES
+#include "Resampler.h"
+
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define RESAMPLER_SSE2
+#endif
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+// passband edge, as a fraction of the Nyquist frequency of the lower rate; the
+// stopband starts where the passband edge aliases, so nothing folds into the passband
+static const double PASSBAND = 0.85;
+// design stopband attenuation in dB, and the Kaiser window beta that gives it; the Kaiser
+// length estimate falls about 1 dB short, so the worst alias or image measures about 79 dB down
+static const double ATTENUATION = 80.0;
+static const double KAISER_BETA = 0.1102 * (ATTENUATION - 8.7);
+
+static const float SAMPLE_MAX = 32767.0f;
+static const float SAMPLE_MIN = -32768.0f;
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/// <summary>
+/// Returns the greatest common divisor of two values.
+/// </summary>
+/// <param name="a"></param>
+/// <param name="b"></param>
+/// <returns></returns>
+static uint32_t gcd(uint32_t a, uint32_t b)
+{
+    while (b != 0U) {
+        uint32_t t = a % b;
+        a = b;
+        b = t;
+    }
+
+    return a;
+}
+
+/// <summary>
+/// Returns the zeroth order modified Bessel function of the first kind.
+/// </summary>
+/// <param name="x"></param>
+/// <returns></returns>
+static double besselI0(double x)
+{
+    double sum = 1.0, term = 1.0;
+    for (uint32_t k = 1U; k < 64U; k++) {
+        double t = x / (2.0 * k);
+        term *= t * t;
+        sum += term;
+        if (term < sum * 1e-12)
+            break;
+    }
+
+    return sum;
+}
+
+/// <summary>
+/// Returns the dot product of a polyphase filter row and a window of samples.
+/// </summary>
+/// <param name="coeffs"></param>
+/// <param name="samples"></param>
+/// <param name="count">Number of taps; a multiple of 4.</param>
+/// <returns></returns>
+static inline float dotProduct(const float* coeffs, const float* samples, uint32_t count)
+{
+#if defined(RESAMPLER_SSE2)
+    __m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+
+    uint32_t i = 0U;
+    for (; i + 8U <= count; i += 8U) {
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(coeffs + i), _mm_loadu_ps(samples + i)));
+        acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(coeffs + i + 4U), _mm_loadu_ps(samples + i + 4U)));
+    }
+    if (i < count)
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(coeffs + i), _mm_loadu_ps(samples + i)));
+
+    __m128 sum = _mm_add_ps(acc0, acc1);
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 0x55));
+    return _mm_cvtss_f32(sum);
+#else
+    float sum = 0.0f;
+    for (uint32_t i = 0U; i < count; i++)
+        sum += coeffs[i] * samples[i];
+
+    return sum;
+#endif
+}
+
+/// <summary>
+/// Rounds float samples to 16-bit samples, clipping them.
+/// </summary>
+/// <param name="in"></param>
+/// <param name="out"></param>
+/// <param name="count"></param>
+static void roundSamples(const float* in, int16_t* out, uint32_t count)
+{
+    uint32_t i = 0U;
+#if defined(RESAMPLER_SSE2)
+    const __m128 vMax = _mm_set1_ps(SAMPLE_MAX);
+    const __m128 vMin = _mm_set1_ps(SAMPLE_MIN);
+    for (; i + 8U <= count; i += 8U) {
+        __m128 lo = _mm_max_ps(_mm_min_ps(_mm_loadu_ps(in + i), vMax), vMin);
+        __m128 hi = _mm_max_ps(_mm_min_ps(_mm_loadu_ps(in + i + 4U), vMax), vMin);
+        _mm_storeu_si128((__m128i*)(out + i), _mm_packs_epi32(_mm_cvtps_epi32(lo), _mm_cvtps_epi32(hi)));
+    }
+#endif
+    for (; i < count; i++) {
+        float value = in[i];
+        if (value > SAMPLE_MAX) {
+            value = SAMPLE_MAX;
+        }
+        else if (value < SAMPLE_MIN) {
+            value = SAMPLE_MIN;
+        }
+
+        out[i] = (int16_t)::lrintf(value);
+    }
+}
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/// <summary>
+/// Initializes a new instance of the Resampler class.
+/// </summary>
+/// <param name="inputRate">Sample rate of input samples.</param>
+/// <param name="outputRate">Sample rate of output samples.</param>
+Resampler::Resampler(uint32_t inputRate, uint32_t outputRate) :
+    m_up(1U),
+    m_down(1U),
+    m_taps(0U),
+    m_time(0U),
+    m_coeffs(nullptr),
+    m_buffer(nullptr),
+    m_blockIn(nullptr),
+    m_blockOut(nullptr)
+{
+    assert(inputRate > 0U);
+    assert(outputRate > 0U);
+
+    uint32_t divisor = gcd(inputRate, outputRate);
+    m_up = outputRate / divisor;
+    m_down = inputRate / divisor;
+    if (m_up == m_down)
+        return;
+
+    // the prototype filter runs at the input rate upsampled by m_up
+    double minRate = (double)((inputRate < outputRate) ? inputRate : outputRate);
+    double upRate = (double)inputRate * m_up;
+    double passband = PASSBAND * (minRate / 2.0);
+    double stopband = minRate - passband;
+    double cutoff = (minRate / 2.0) / upRate;
+    double transition = (stopband - passband) / upRate;
+
+    uint32_t length = (uint32_t)::ceil((ATTENUATION - 8.0) / (2.285 * 2.0 * M_PI * transition));
+    m_taps = (length + m_up - 1U) / m_up;
+    m_taps = (m_taps + 3U) & ~3U;
+    length = m_taps * m_up;
+
+    // tap k of phase p is stored reversed, so each output is a dot product with the newest m_taps samples
+    m_coeffs = new float[length];
+    double center = (length - 1U) / 2.0;
+    double i0Beta = besselI0(KAISER_BETA);
+    for (uint32_t n = 0U; n < length; n++) {
+        double x = n - center;
+        double sinc = (x == 0.0) ? 1.0 : ::sin(2.0 * M_PI * cutoff * x) / (2.0 * M_PI * cutoff * x);
+        double r = x / center;
+        double window = besselI0(KAISER_BETA * ::sqrt(1.0 - (r * r))) / i0Beta;
+
+        uint32_t phase = n % m_up;
+        uint32_t k = n / m_up;
+        m_coeffs[(phase * m_taps) + (m_taps - 1U - k)] = (float)(2.0 * cutoff * m_up * sinc * window);
+    }
+
+    m_buffer = new float[m_taps - 1U + BLOCK_SAMPLES];
+    m_blockIn = new float[BLOCK_SAMPLES];
+    m_blockOut = new float[((BLOCK_SAMPLES * m_up) / m_down) + 1U];
+
+    reset();
+}
+
+/// <summary>
+/// Finalizes a instance of the Resampler class.
+/// </summary>
+Resampler::~Resampler()
+{
+    delete[] m_coeffs;
+    delete[] m_buffer;
+    delete[] m_blockIn;
+    delete[] m_blockOut;
+}
+
+/// <summary>
+/// Returns true if the sample rate can be converted to and from 8 kHz.
+/// </summary>
+/// <param name="rate"></param>
+/// <returns></returns>
+bool Resampler::isSupportedRate(uint32_t rate)
+{
+    switch (rate) {
+    case 8000U:
+    case 16000U:
+    case 44100U:
+    case 48000U:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/// <summary>
+/// Returns the number of samples the next process() call produces from the given input count.
+/// </summary>
+/// <param name="count">Number of input samples.</param>
+/// <returns></returns>
+uint32_t Resampler::getOutputCount(uint32_t count) const
+{
+    if (m_up == m_down)
+        return count;
+
+    uint64_t end = (uint64_t)count * m_up;
+    if (end <= m_time)
+        return 0U;
+
+    return (uint32_t)((end - m_time + m_down - 1U) / m_down);
+}
+
+/// <summary>
+/// Resamples float samples, returning the number of samples written.
+/// </summary>
+/// <param name="in">Input samples.</param>
+/// <param name="count">Number of input samples.</param>
+/// <param name="out">Output samples; must hold getOutputCount(count) samples.</param>
+/// <returns></returns>
+uint32_t Resampler::process(const float* in, uint32_t count, float* out)
+{
+    assert(in != nullptr);
+    assert(out != nullptr);
+
+    if (m_up == m_down) {
+        ::memcpy(out, in, count * sizeof(float));
+        return count;
+    }
+
+    uint32_t written = 0U;
+    for (uint32_t i = 0U; i < count; i += BLOCK_SAMPLES) {
+        uint32_t length = ((count - i) < BLOCK_SAMPLES) ? (count - i) : BLOCK_SAMPLES;
+        written += processBlock(in + i, length, out + written);
+    }
+
+    return written;
+}
+
+/// <summary>
+/// Resamples 16-bit samples, returning the number of samples written.
+/// </summary>
+/// <param name="in">Input samples.</param>
+/// <param name="count">Number of input samples.</param>
+/// <param name="out">Output samples; must hold getOutputCount(count) samples.</param>
+/// <returns></returns>
+uint32_t Resampler::process(const int16_t* in, uint32_t count, int16_t* out)
+{
+    assert(in != nullptr);
+    assert(out != nullptr);
+
+    if (m_up == m_down) {
+        ::memcpy(out, in, count * sizeof(int16_t));
+        return count;
+    }
+
+    uint32_t written = 0U;
+    for (uint32_t i = 0U; i < count; i += BLOCK_SAMPLES) {
+        uint32_t length = ((count - i) < BLOCK_SAMPLES) ? (count - i) : BLOCK_SAMPLES;
+        for (uint32_t n = 0U; n < length; n++)
+            m_blockIn[n] = (float)in[i + n];
+
+        uint32_t produced = processBlock(m_blockIn, length, m_blockOut);
+        roundSamples(m_blockOut, out + written, produced);
+        written += produced;
+    }
+
+    return written;
+}
+
+/// <summary>
+/// Clears the filter history.
+/// </summary>
+void Resampler::reset()
+{
+    m_time = 0U;
+    if (m_buffer != nullptr)
+        ::memset(m_buffer, 0x00U, (m_taps - 1U + BLOCK_SAMPLES) * sizeof(float));
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/// <summary>
+/// Resamples up to BLOCK_SAMPLES float samples.
+/// </summary>
+/// <param name="in"></param>
+/// <param name="count"></param>
+/// <param name="out"></param>
+/// <returns></returns>
+uint32_t Resampler::processBlock(const float* in, uint32_t count, float* out)
+{
+    // the buffer holds the last m_taps - 1 samples of the previous block ahead of this one
+    ::memcpy(m_buffer + (m_taps - 1U), in, count * sizeof(float));
+
+    uint32_t written = 0U;
+    uint32_t end = count * m_up;
+    while (m_time < end) {
+        uint32_t base = m_time / m_up;
+        uint32_t phase = m_time % m_up;
+        out[written++] = dotProduct(m_coeffs + (phase * m_taps), m_buffer + base, m_taps);
+        m_time += m_down;
+    }
+
+    m_time -= end;
+    ::memmove(m_buffer, m_buffer + count, (m_taps - 1U) * sizeof(float));
+
+    return written;
+}
@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/**
+* Digital Voice Modem - MBE Vocoder
+* GPLv2 Open Source. Use is subject to license terms.
+* DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+*
+* @package DVM / MBE Vocoder
+* @license GPLv2 License (https://opensource.org/licenses/GPL-2.0)
+*
+*/
+#if !defined(__RESAMPLER_H__)
+#define __RESAMPLER_H__
+
+#include "Defines.h"
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+const uint32_t MBE_SAMPLE_RATE = 8000U;
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+//      Implements streaming rational sample rate conversion with a Kaiser
+//      windowed-sinc polyphase filter. State carries across calls, so a
+//      stream may be fed in blocks of any length. 16-bit samples are
+//      rounded and clipped on output.
+// ---------------------------------------------------------------------------
+
+class HOST_SW_API Resampler {
+public:
+    /// <summary>Initializes a new instance of the Resampler class.</summary>
+    Resampler(uint32_t inputRate, uint32_t outputRate);
+    /// <summary>Finalizes a instance of the Resampler class.</summary>
+    ~Resampler();
+
+    /// <summary>Returns true if the sample rate can be converted to and from 8 kHz.</summary>
+    static bool isSupportedRate(uint32_t rate);
+
+    /// <summary>Returns the number of samples the next process() call produces from the given input count.</summary>
+    uint32_t getOutputCount(uint32_t count) const;
+
+    /// <summary>Resamples float samples, returning the number of samples written.</summary>
+    uint32_t process(const float* in, uint32_t count, float* out);
+    /// <summary>Resamples 16-bit samples, returning the number of samples written.</summary>
+    uint32_t process(const int16_t* in, uint32_t count, int16_t* out);
+
+    /// <summary>Clears the filter history.</summary>
+    void reset();
+
+private:
+    static const uint32_t BLOCK_SAMPLES = 256U;
+
+    uint32_t m_up;
+    uint32_t m_down;
+    uint32_t m_taps;
+    uint32_t m_time;
+
+    float* m_coeffs;
+    float* m_buffer;
+    float* m_blockIn;
+    float* m_blockOut;
+
+    /// <summary>Resamples up to BLOCK_SAMPLES float samples.</summary>
+    uint32_t processBlock(const float* in, uint32_t count, float* out);
+};
+
+#endif // __RESAMPLER_H__
@@ -13,21 +13,11 @@
 *
 */
 #include "Utils.h"
+#include "BitOps.h"
 
 #include <cstdio>
 #include <cassert>
 
-// ---------------------------------------------------------------------------
-//  Constants/Macros
-// ---------------------------------------------------------------------------
-
-const uint8_t BITS_TABLE[] = {
-#   define B2(n) n,     n+1,     n+1,     n+2
-#   define B4(n) B2(n), B2(n+1), B2(n+1), B2(n+2)
-#   define B6(n) B4(n), B4(n+1), B4(n+1), B4(n+2)
-    B6(0), B6(1), B6(1), B6(2)
-};
-
 // ---------------------------------------------------------------------------
 //  Static Class Members
 // ---------------------------------------------------------------------------
@@ -120,13 +110,11 @@ uint32_t Utils::getBits(const uint8_t* in, uint8_t* out, uint32_t start, uint32_
     assert(in != NULL);
     assert(out != NULL);
 
-    uint32_t n = 0U;
-    for (uint32_t i = start; i < stop; i++, n++) {
-        bool b = READ_BIT(in, i);
-        WRITE_BIT(out, n, b);
-    }
+    if (stop <= start)
+        return 0U;
 
-    return n;
+    BitOps::copyBits(in, start, out, 0U, stop - start);
+    return stop - start;
 }
 
 /// <summary>
@@ -153,13 +141,11 @@ uint32_t Utils::setBits(const uint8_t* in, uint8_t* out, uint32_t start, uint32_
     assert(in != NULL);
     assert(out != NULL);
 
-    uint32_t n = 0U;
-    for (uint32_t i = start; i < stop; i++, n++) {
-        bool b = READ_BIT(in, n);
-        WRITE_BIT(out, i, b);
-    }
+    if (stop <= start)
+        return 0U;
 
-    return n;
+    BitOps::copyBits(in, 0U, out, start, stop - start);
+    return stop - start;
 }
 
 /// <summary>
@@ -173,49 +159,3 @@ uint32_t Utils::setBitRange(const uint8_t* in, uint8_t* out, uint32_t start, uin
 {
     return setBits(in, out, start, start + length);
 }
-
-/// <summary>
-/// Returns the count of bits in the passed 8 byte value.
-/// </summary>
-/// <param name="bits"></param>
-/// <returns></returns>
-uint8_t Utils::countBits8(uint8_t bits)
-{
-    return BITS_TABLE[bits];
-}
-
-/// <summary>
-/// Returns the count of bits in the passed 32 byte value.
-/// </summary>
-/// <param name="bits"></param>
-/// <returns></returns>
-uint8_t Utils::countBits32(uint32_t bits)
-{
-    uint8_t* p = (uint8_t*)&bits;
-    uint8_t n = 0U;
-    n += BITS_TABLE[p[0U]];
-    n += BITS_TABLE[p[1U]];
-    n += BITS_TABLE[p[2U]];
-    n += BITS_TABLE[p[3U]];
-    return n;
-}
-
-/// <summary>
-/// Returns the count of bits in the passed 64 byte value.
-/// </summary>
-/// <param name="bits"></param>
-/// <returns></returns>
-uint8_t Utils::countBits64(ulong64_t bits)
-{
-    uint8_t* p = (uint8_t*)&bits;
-    uint8_t n = 0U;
-    n += BITS_TABLE[p[0U]];
-    n += BITS_TABLE[p[1U]];
-    n += BITS_TABLE[p[2U]];
-    n += BITS_TABLE[p[3U]];
-    n += BITS_TABLE[p[4U]];
-    n += BITS_TABLE[p[5U]];
-    n += BITS_TABLE[p[6U]];
-    n += BITS_TABLE[p[7U]];
-    return n;
-}
@@ -16,6 +16,7 @@
 #define __UTILS_H__
 
 #include "Defines.h"
+#include "BitOps.h"
 
 #include <string>
 
@@ -47,11 +48,11 @@ public:
     static uint32_t setBitRange(const uint8_t* in, uint8_t* out, uint32_t start, uint32_t length);
 
     /// <summary>Returns the count of bits in the passed 8 byte value.</summary>
-    static uint8_t countBits8(uint8_t bits);
+    static __forceinline uint8_t countBits8(uint8_t bits) { return (uint8_t)BitOps::popcount32(bits); }
     /// <summary>Returns the count of bits in the passed 32 byte value.</summary>
-    static uint8_t countBits32(uint32_t bits);
+    static __forceinline uint8_t countBits32(uint32_t bits) { return (uint8_t)BitOps::popcount32(bits); }
     /// <summary>Returns the count of bits in the passed 64 byte value.</summary>
-    static uint8_t countBits64(ulong64_t bits);
+    static __forceinline uint8_t countBits64(ulong64_t bits) { return (uint8_t)BitOps::popcount64(bits); }
 };
 #endif
 
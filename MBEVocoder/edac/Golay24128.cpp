@@ -22,6 +22,21 @@ using namespace edac;
 #include <cstdio>
 #include <cassert>
 
+// the AVX2 batch kernels are built on every x64 target and chosen at runtime by CPUID
+#if defined(_M_X64) || defined(__x86_64__)
+#define GOLAY_BATCH_AVX2
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#include <immintrin.h>
+#endif
+
+#if defined(GOLAY_BATCH_AVX2) && (defined(__GNUC__) || defined(__clang__))
+#define GOLAY_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define GOLAY_TARGET_AVX2
+#endif
+
 // ---------------------------------------------------------------------------
 //  Constants
 // ---------------------------------------------------------------------------
@@ -1057,10 +1072,143 @@ static const uint32_t DECODING_TABLE_23127[] = {
     0x403000U, 0x080840U, 0x100044U, 0x011008U, 0x022800U, 0x004110U, 0x100040U, 0x100041U, 0x100042U, 0x440020U,
     0x011001U, 0x011000U, 0x080420U, 0x011002U, 0x100048U, 0x011004U, 0x204200U, 0x028080U };
 
-#define X22             0x00400000   /* vector representation of X^{22} */
-#define X11             0x00000800   /* vector representation of X^{11} */
-#define MASK12          0xfffff800   /* auxiliary vector for testing */
-#define GENPOL          0x00000c75   /* generator polinomial, g(x) */
+// Golay (23,12,7) syndromes of codeword bits 11 - 18 and 19 - 22; the remainders of each
+// chunk value times x^11 and x^19 modulo the generator polynomial
+static const uint32_t SYNDROME_TABLE_23127_LO[] = {
+    0x000U, 0x475U, 0x49FU, 0x0EAU, 0x54BU, 0x13EU, 0x1D4U, 0x5A1U, 0x6E3U, 0x296U,
+    0x27CU, 0x609U, 0x3A8U, 0x7DDU, 0x737U, 0x342U, 0x1B3U, 0x5C6U, 0x52CU, 0x159U,
+    0x4F8U, 0x08DU, 0x067U, 0x412U, 0x750U, 0x325U, 0x3CFU, 0x7BAU, 0x21BU, 0x66EU,
+    0x684U, 0x2F1U, 0x366U, 0x713U, 0x7F9U, 0x38CU, 0x62DU, 0x258U, 0x2B2U, 0x6C7U,
+    0x585U, 0x1F0U, 0x11AU, 0x56FU, 0x0CEU, 0x4BBU, 0x451U, 0x024U, 0x2D5U, 0x6A0U,
+    0x64AU, 0x23FU, 0x79EU, 0x3EBU, 0x301U, 0x774U, 0x436U, 0x043U, 0x0A9U, 0x4DCU,
+    0x17DU, 0x508U, 0x5E2U, 0x197U, 0x6CCU, 0x2B9U, 0x253U, 0x626U, 0x387U, 0x7F2U,
+    0x718U, 0x36DU, 0x02FU, 0x45AU, 0x4B0U, 0x0C5U, 0x564U, 0x111U, 0x1FBU, 0x58EU,
+    0x77FU, 0x30AU, 0x3E0U, 0x795U, 0x234U, 0x641U, 0x6ABU, 0x2DEU, 0x19CU, 0x5E9U,
+    0x503U, 0x176U, 0x4D7U, 0x0A2U, 0x048U, 0x43DU, 0x5AAU, 0x1DFU, 0x135U, 0x540U,
+    0x0E1U, 0x494U, 0x47EU, 0x00BU, 0x349U, 0x73CU, 0x7D6U, 0x3A3U, 0x602U, 0x277U,
+    0x29DU, 0x6E8U, 0x419U, 0x06CU, 0x086U, 0x4F3U, 0x152U, 0x527U, 0x5CDU, 0x1B8U,
+    0x2FAU, 0x68FU, 0x665U, 0x210U, 0x7B1U, 0x3C4U, 0x32EU, 0x75BU, 0x1EDU, 0x598U,
+    0x572U, 0x107U, 0x4A6U, 0x0D3U, 0x039U, 0x44CU, 0x70EU, 0x37BU, 0x391U, 0x7E4U,
+    0x245U, 0x630U, 0x6DAU, 0x2AFU, 0x05EU, 0x42BU, 0x4C1U, 0x0B4U, 0x515U, 0x160U,
+    0x18AU, 0x5FFU, 0x6BDU, 0x2C8U, 0x222U, 0x657U, 0x3F6U, 0x783U, 0x769U, 0x31CU,
+    0x28BU, 0x6FEU, 0x614U, 0x261U, 0x7C0U, 0x3B5U, 0x35FU, 0x72AU, 0x468U, 0x01DU,
+    0x0F7U, 0x482U, 0x123U, 0x556U, 0x5BCU, 0x1C9U, 0x338U, 0x74DU, 0x7A7U, 0x3D2U,
+    0x673U, 0x206U, 0x2ECU, 0x699U, 0x5DBU, 0x1AEU, 0x144U, 0x531U, 0x090U, 0x4E5U,
+    0x40FU, 0x07AU, 0x721U, 0x354U, 0x3BEU, 0x7CBU, 0x26AU, 0x61FU, 0x6F5U, 0x280U,
+    0x1C2U, 0x5B7U, 0x55DU, 0x128U, 0x489U, 0x0FCU, 0x016U, 0x463U, 0x692U, 0x2E7U,
+    0x20DU, 0x678U, 0x3D9U, 0x7ACU, 0x746U, 0x333U, 0x071U, 0x404U, 0x4EEU, 0x09BU,
+    0x53AU, 0x14FU, 0x1A5U, 0x5D0U, 0x447U, 0x032U, 0x0D8U, 0x4ADU, 0x10CU, 0x579U,
+    0x593U, 0x1E6U, 0x2A4U, 0x6D1U, 0x63BU, 0x24EU, 0x7EFU, 0x39AU, 0x370U, 0x705U,
+    0x5F4U, 0x181U, 0x16BU, 0x51EU, 0x0BFU, 0x4CAU, 0x420U, 0x055U, 0x317U, 0x762U,
+    0x788U, 0x3FDU, 0x65CU, 0x229U, 0x2C3U, 0x6B6U };
+
+static const uint32_t SYNDROME_TABLE_23127_HI[] = {
+    0x000U, 0x3DAU, 0x7B4U, 0x46EU, 0x31DU, 0x0C7U, 0x4A9U, 0x773U, 0x63AU, 0x5E0U,
+    0x18EU, 0x254U, 0x527U, 0x6FDU, 0x293U, 0x149U };
+
+#if defined(GOLAY_BATCH_AVX2)
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/// <summary>
+/// Checks whether the CPU and OS support the AVX2 instructions.
+/// </summary>
+/// <returns></returns>
+static bool cpuHasAVX2()
+{
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7)
+        return false;
+
+    // AVX and OSXSAVE, with the YMM state enabled by the OS
+    __cpuid(info, 1);
+    if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0)
+        return false;
+    if ((_xgetbv(0) & 0x6U) != 0x6U)
+        return false;
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+
+/// <summary>
+/// Decodes Golay (23,12,7) codewords 8 at a time with AVX2 gathers into the syndrome and decoding tables.
+/// </summary>
+/// <param name="codes">Golay (23,12,7) codewords.</param>
+/// <param name="data">Decoded 12-bit data for each codeword.</param>
+/// <param name="count">Number of codewords.</param>
+/// <returns>Number of codewords decoded; a multiple of 8.</returns>
+GOLAY_TARGET_AVX2 static uint32_t decode23127AVX2(const uint32_t* codes, uint32_t* data, uint32_t count)
+{
+    const __m256i mask11 = _mm256_set1_epi32(0x7FF);
+    const __m256i mask8 = _mm256_set1_epi32(0xFF);
+    const __m256i mask4 = _mm256_set1_epi32(0x0F);
+
+    uint32_t i = 0U;
+    for (; i + 8U <= count; i += 8U) {
+        __m256i code = _mm256_loadu_si256((const __m256i*)(codes + i));
+        __m256i syndrome = _mm256_and_si256(code, mask11);
+        syndrome = _mm256_xor_si256(syndrome, _mm256_i32gather_epi32((const int*)SYNDROME_TABLE_23127_LO,
+            _mm256_and_si256(_mm256_srli_epi32(code, 11), mask8), 4));
+        syndrome = _mm256_xor_si256(syndrome, _mm256_i32gather_epi32((const int*)SYNDROME_TABLE_23127_HI,
+            _mm256_and_si256(_mm256_srli_epi32(code, 19), mask4), 4));
+
+        __m256i error_pattern = _mm256_i32gather_epi32((const int*)DECODING_TABLE_23127, syndrome, 4);
+        _mm256_storeu_si256((__m256i*)(data + i), _mm256_srli_epi32(_mm256_xor_si256(code, error_pattern), 11));
+    }
+
+    return i;
+}
+
+/// <summary>
+/// Corrects Golay (24,12,8) codewords 8 at a time with AVX2 gathers, keeping the (23,12,7) syndromes.
+/// </summary>
+/// <param name="code">Golay (24,12,8) codewords.</param>
+/// <param name="syndromes">(23,12,7) syndrome of each codeword.</param>
+/// <param name="corrected">Corrected codewords.</param>
+/// <param name="count">Number of codewords.</param>
+/// <returns>Number of codewords corrected; a multiple of 8.</returns>
+GOLAY_TARGET_AVX2 static uint32_t correct24128AVX2(const uint32_t* code, uint32_t* syndromes, uint32_t* corrected, uint32_t count)
+{
+    const __m256i mask11 = _mm256_set1_epi32(0x7FF);
+    const __m256i mask8 = _mm256_set1_epi32(0xFF);
+    const __m256i mask4 = _mm256_set1_epi32(0x0F);
+
+    uint32_t i = 0U;
+    for (; i + 8U <= count; i += 8U) {
+        __m256i c = _mm256_loadu_si256((const __m256i*)(code + i));
+        __m256i c23 = _mm256_srli_epi32(c, 1);
+        __m256i syndrome = _mm256_and_si256(c23, mask11);
+        syndrome = _mm256_xor_si256(syndrome, _mm256_i32gather_epi32((const int*)SYNDROME_TABLE_23127_LO,
+            _mm256_and_si256(_mm256_srli_epi32(c23, 11), mask8), 4));
+        syndrome = _mm256_xor_si256(syndrome, _mm256_i32gather_epi32((const int*)SYNDROME_TABLE_23127_HI,
+            _mm256_and_si256(_mm256_srli_epi32(c23, 19), mask4), 4));
+
+        __m256i error_pattern = _mm256_slli_epi32(_mm256_i32gather_epi32((const int*)DECODING_TABLE_23127, syndrome, 4), 1);
+        _mm256_storeu_si256((__m256i*)(syndromes + i), syndrome);
+        _mm256_storeu_si256((__m256i*)(corrected + i), _mm256_xor_si256(c, error_pattern));
+    }
+
+    return i;
+}
+
+/// <summary>
+/// Returns true if the AVX2 batch kernels can run; checked once.
+/// </summary>
+/// <returns></returns>
+static bool useAVX2()
+{
+    static const bool avx2 = cpuHasAVX2();
+    return avx2;
+}
+#endif // defined(GOLAY_BATCH_AVX2)
 
 // ---------------------------------------------------------------------------
 //  Static Class Members
@@ -1094,7 +1242,7 @@ bool Golay24128::decode24128(uint32_t code, uint32_t& out)
 
     out = code ^ error_pattern;
 
-    bool valid = (Utils::countBits32(syndrome) < 3U) || !(Utils::countBits32(out) & 1);
+    bool valid = isValid24128(syndrome, out);
     out >>= 12;
 
     return valid;
@@ -1125,36 +1273,40 @@ void Golay24128::decode24128(uint8_t* data, const uint8_t* raw, uint32_t msglen)
 {
     uint32_t i = 0;                  // decoded byte counter
     uint32_t j = 0;                  // encoded byte counter
-    uint32_t r0, r1, r2, r3, r4, r5; // six 8-bit bytes
-    uint32_t v0, v1;                 // two 24-bit encoded symbols
+    uint32_t r0, r1, r2;             // three 8-bit bytes
+    uint32_t v0;                     // 24-bit encoded symbol
     uint32_t m0_hat, m1_hat;         // two 12-bit decoded symbols
 
+    uint32_t v[BATCH_SIZE];          // batch of 24-bit encoded symbols
+    uint32_t m_hat[BATCH_SIZE];      // batch of 12-bit decoded symbols
+
     // determine remainder of input length / 3
     uint32_t r = msglen % 3;
 
-    for (i = 0; i < msglen - r; i += 3) {
-        // strip six input bytes (two encoded symbols)
-        r0 = raw[j + 0];
-        r1 = raw[j + 1];
-        r2 = raw[j + 2];
-        r3 = raw[j + 3];
-        r4 = raw[j + 4];
-        r5 = raw[j + 5];
-
-        // pack six 8-bit symbols into two 24-bit symbols
-        v0 = ((r0 << 16) & 0xff0000) | ((r1 << 8) & 0x00ff00) | ((r2) & 0x0000ff);
-        v1 = ((r3 << 16) & 0xff0000) | ((r4 << 8) & 0x00ff00) | ((r5 << 0) & 0x0000ff);
+    while (i < msglen - r) {
+        // strip up to a batch of input byte pairs (two encoded symbols each)
+        uint32_t n = 0U;
+        for (uint32_t k = j; n < BATCH_SIZE && (i + ((n / 2U) * 3U)) < msglen - r; n += 2U, k += 6U) {
+            // pack six 8-bit symbols into two 24-bit symbols
+            v[n + 0U] = ((raw[k + 0] << 16) & 0xff0000) | ((raw[k + 1] << 8) & 0x00ff00) | ((raw[k + 2]) & 0x0000ff);
+            v[n + 1U] = ((raw[k + 3] << 16) & 0xff0000) | ((raw[k + 4] << 8) & 0x00ff00) | ((raw[k + 5]) & 0x0000ff);
+        }
 
         // decode each symbol into a 12-bit symbol
-        decode24128(v0, m0_hat);
-        decode24128(v1, m1_hat);
+        decode24128(v, m_hat, nullptr, n);
 
-        // unpack two 12-bit symbols into three 8-bit bytes
-        data[i + 0] = ((m0_hat >> 4) & 0xff);
-        data[i + 1] = ((m0_hat << 4) & 0xf0) | ((m1_hat >> 8) & 0x0f);
-        data[i + 2] = ((m1_hat) & 0xff);
+        for (uint32_t k = 0U; k < n; k += 2U) {
+            m0_hat = m_hat[k + 0U];
+            m1_hat = m_hat[k + 1U];
 
-        j += 6;
+            // unpack two 12-bit symbols into three 8-bit bytes
+            data[i + 0] = ((m0_hat >> 4) & 0xff);
+            data[i + 1] = ((m0_hat << 4) & 0xf0) | ((m1_hat >> 8) & 0x0f);
+            data[i + 2] = ((m1_hat) & 0xff);
+
+            i += 3;
+            j += 6;
+        }
     }
 
     // if input length isn't divisible by 3, decode last 1 or two bytes
@@ -1177,6 +1329,75 @@ void Golay24128::decode24128(uint8_t* data, const uint8_t* raw, uint32_t msglen)
     }
 }
 
+/// <summary>
+/// Decode an array of Golay (23,12,7) FEC codewords.
+/// </summary>
+/// <param name="codes">Golay (23,12,7) codewords.</param>
+/// <param name="data">Decoded 12-bit data for each codeword.</param>
+/// <param name="count">Number of codewords.</param>
+void Golay24128::decode23127(const uint32_t* codes, uint32_t* data, uint32_t count)
+{
+    assert(codes != nullptr);
+    assert(data != nullptr);
+
+    uint32_t i = 0U;
+#if defined(GOLAY_BATCH_AVX2)
+    if (useAVX2())
+        i = decode23127AVX2(codes, data, count);
+#endif
+    for (; i < count; i++)
+        data[i] = decode23127(codes[i]);
+}
+
+/// <summary>
+/// Decode an array of Golay (24,12,8) FEC codewords.
+/// </summary>
+/// <param name="codes">Golay (24,12,8) codewords.</param>
+/// <param name="data">Decoded 12-bit data for each codeword.</param>
+/// <param name="valid">Validity of each codeword; may be null.</param>
+/// <param name="count">Number of codewords.</param>
+/// <returns>Count of valid codewords.</returns>
+uint32_t Golay24128::decode24128(const uint32_t* codes, uint32_t* data, bool* valid, uint32_t count)
+{
+    assert(codes != nullptr);
+    assert(data != nullptr);
+
+    uint32_t syndromes[BATCH_SIZE];
+    uint32_t corrected[BATCH_SIZE];
+
+    uint32_t validCount = 0U;
+    for (uint32_t offset = 0U; offset < count; offset += BATCH_SIZE) {
+        uint32_t n = (count - offset) < BATCH_SIZE ? (count - offset) : BATCH_SIZE;
+        const uint32_t* code = codes + offset;
+
+        uint32_t i = 0U;
+#if defined(GOLAY_BATCH_AVX2)
+        if (useAVX2())
+            i = correct24128AVX2(code, syndromes, corrected, n);
+#endif
+        for (; i < n; i++) {
+            syndromes[i] = getSyndrome23127(code[i] >> 1);
+            corrected[i] = code[i] ^ (DECODING_TABLE_23127[syndromes[i]] << 1);
+        }
+
+        for (i = 0U; i < n; i++)
+            data[offset + i] = corrected[i] >> 12;
+
+        if (valid != nullptr) {
+            for (i = 0U; i < n; i++) {
+                valid[offset + i] = isValid24128(syndromes[i], corrected[i]);
+                validCount += valid[offset + i] ? 1U : 0U;
+            }
+        }
+        else {
+            for (i = 0U; i < n; i++)
+                validCount += isValid24128(syndromes[i], corrected[i]) ? 1U : 0U;
+        }
+    }
+
+    return validCount;
+}
+
 /// <summary>
 /// Encode Golay (23,12,7) FEC.
 /// </summary>
@@ -1270,26 +1491,47 @@ void Golay24128::encode24128(uint8_t* data, const uint8_t* raw, uint32_t msglen)
 /// <remarks>
 /// Compute the syndrome corresponding to the given pattern, i.e., the
 /// remainder after dividing the pattern (when considering it as the vector
-/// representation of a polynomial) by the generator polynomial, GENPOL.
-/// In the program this pattern has several meanings: (1) pattern = infomation
-/// bits, when constructing the encoding table; (2) pattern = error pattern,
-/// when constructing the decoding table; and (3) pattern = received vector, to
-/// obtain its syndrome in decoding.
+/// representation of a polynomial) by the generator polynomial, 0xC75. The
+/// division is linear, so the low 11 bits pass straight through and the bits
+/// above them are reduced with two chunk table lookups, CRC style.
 /// </remarks>
 /// <param name="pattern"></param>
 /// <returns></returns>
 uint32_t Golay24128::getSyndrome23127(uint32_t pattern)
 {
-    uint32_t aux = X22;
+    return (pattern & 0x7FFU) ^ SYNDROME_TABLE_23127_LO[(pattern >> 11) & 0xFFU] ^ SYNDROME_TABLE_23127_HI[(pattern >> 19) & 0x0FU];
+}
 
-    if (pattern >= X11) {
-        while (pattern & MASK12) {
-            while (!(aux & pattern))
-                aux = aux >> 1;
+/// <summary>
+/// Checks a corrected Golay (24,12,8) codeword; it is valid when at most two bits were
+/// corrected or the overall parity is even.
+/// </summary>
+/// <param name="syndrome">Golay (23,12,7) syndrome of the codeword.</param>
+/// <param name="code">Corrected 24-bit codeword.</param>
+/// <returns></returns>
+bool Golay24128::isValid24128(uint32_t syndrome, uint32_t code)
+{
+    code ^= code >> 16;
+    code ^= code >> 8;
+    code ^= code >> 4;
+    bool odd = ((0x6996U >> (code & 0x0FU)) & 0x01U) == 0x01U;
 
-            pattern ^= (aux / X11) * GENPOL;
-        }
-    }
+    // fewer than three syndrome bits set, i.e. clearing the lowest set bit twice leaves nothing
+    syndrome &= syndrome - 1U;
+    syndrome &= syndrome - 1U;
+    return (syndrome == 0U) || !odd;
+}
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
 
-    return pattern;
+/// <summary>
+/// Decode Golay (23,12,7) FEC; entry point for the mbelib C ECC routines.
+/// </summary>
+/// <param name="code"></param>
+/// <returns></returns>
+extern "C" unsigned int mbe_golayDecode23127(unsigned int code)
+{
+    return Golay24128::decode23127(code);
 }
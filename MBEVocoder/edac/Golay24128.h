@@ -35,6 +35,10 @@ namespace edac
         static bool decode24128(uint8_t* bytes, uint32_t& out);
         /// <summary>Decode Golay (24,12,8) FEC.</summary>
         static void decode24128(uint8_t* data, const uint8_t* raw, uint32_t msglen);
+        /// <summary>Decode an array of Golay (23,12,7) FEC codewords.</summary>
+        static void decode23127(const uint32_t* codes, uint32_t* data, uint32_t count);
+        /// <summary>Decode an array of Golay (24,12,8) FEC codewords.</summary>
+        static uint32_t decode24128(const uint32_t* codes, uint32_t* data, bool* valid, uint32_t count);
 
         /// <summary>Encode Golay (23,12,7) FEC.</summary>
         static uint32_t encode23127(uint32_t data);
@@ -44,8 +48,13 @@ namespace edac
         static void encode24128(uint8_t* data, const uint8_t* raw, uint32_t msglen);
 
     private:
+        /// <summary>Number of codewords handled per batch pass.</summary>
+        static const uint32_t BATCH_SIZE = 64U;
+
         /// <summary></summary>
         static uint32_t getSyndrome23127(uint32_t pattern);
+        /// <summary></summary>
+        static bool isValid24128(uint32_t syndrome, uint32_t code);
     };
 } // namespace edac
 
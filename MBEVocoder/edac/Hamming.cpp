@@ -18,6 +18,127 @@ using namespace edac;
 #include <cstdio>
 #include <cassert>
 
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+// Packed codewords hold d[0] in the most significant bit and the check bits in the
+// least significant bits. Each parity mask covers the data bits of one check plus the
+// check bit itself, and each error mask table maps a syndrome to the bit to flip (zero
+// where the syndrome is not correctable).
+
+static const uint32_t PARITY_MASK_15113_1[] = { 0x7F08U, 0x78E4U, 0x66D2U, 0x55B1U };
+static const uint32_t ERROR_MASK_15113_1[] = {
+    0x0000U, 0x0008U, 0x0004U, 0x0800U, 0x0002U, 0x0200U, 0x0040U, 0x2000U,
+    0x0001U, 0x0100U, 0x0020U, 0x1000U, 0x0010U, 0x0400U, 0x0080U, 0x4000U };
+
+static const uint32_t PARITY_MASK_15113_2[] = { 0x7AC8U, 0x3D64U, 0x1EB2U, 0x7591U };
+static const uint32_t ERROR_MASK_15113_2[] = {
+    0x0000U, 0x0008U, 0x0004U, 0x0040U, 0x0002U, 0x0200U, 0x0020U, 0x0800U,
+    0x0001U, 0x4000U, 0x0100U, 0x2000U, 0x0010U, 0x0080U, 0x0400U, 0x1000U };
+
+static const uint32_t PARITY_MASK_1393[] = { 0x1AC8U, 0x1D64U, 0x1EB2U, 0x1591U };
+static const uint32_t ERROR_MASK_1393[] = {
+    0x0000U, 0x0008U, 0x0004U, 0x0040U, 0x0002U, 0x0200U, 0x0020U, 0x0800U,
+    0x0001U, 0x0000U, 0x0100U, 0x0000U, 0x0010U, 0x0080U, 0x0400U, 0x1000U };
+
+static const uint32_t PARITY_MASK_1063[] = { 0x0398U, 0x0354U, 0x02E2U, 0x01E1U };
+static const uint32_t ERROR_MASK_1063[] = {
+    0x0000U, 0x0008U, 0x0004U, 0x0010U, 0x0002U, 0x0000U, 0x0000U, 0x0200U,
+    0x0001U, 0x0000U, 0x0000U, 0x0100U, 0x0020U, 0x0080U, 0x0040U, 0x0000U };
+
+static const uint32_t PARITY_MASK_16114[] = { 0xF590U, 0x7AC8U, 0x3D64U, 0xEB22U, 0xA6E1U };
+static const uint32_t ERROR_MASK_16114[] = {
+    0x0000U, 0x0010U, 0x0008U, 0x0000U, 0x0004U, 0x0000U, 0x0000U, 0x1000U,
+    0x0002U, 0x0000U, 0x0000U, 0x4000U, 0x0000U, 0x0100U, 0x0800U, 0x0000U,
+    0x0001U, 0x0000U, 0x0000U, 0x0080U, 0x0000U, 0x0400U, 0x0040U, 0x0000U,
+    0x0000U, 0x8000U, 0x0200U, 0x0000U, 0x0020U, 0x0000U, 0x0000U, 0x2000U };
+
+static const uint32_t PARITY_MASK_17123[] = { 0x1E690U, 0x1F348U, 0x0F9A4U, 0x19A42U, 0x1CD21U };
+static const uint32_t ERROR_MASK_17123[] = {
+    0x00000U, 0x00010U, 0x00008U, 0x00000U, 0x00004U, 0x00080U, 0x00000U, 0x02000U,
+    0x00002U, 0x00000U, 0x00040U, 0x00200U, 0x00000U, 0x00000U, 0x01000U, 0x00000U,
+    0x00001U, 0x00400U, 0x00000U, 0x00000U, 0x00020U, 0x00000U, 0x00100U, 0x04000U,
+    0x00000U, 0x00000U, 0x00000U, 0x10000U, 0x00800U, 0x00000U, 0x00000U, 0x08000U };
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/// <summary>
+/// Returns the parity (XOR of all bits) of the given word.
+/// </summary>
+/// <param name="x"></param>
+/// <returns></returns>
+static inline uint32_t parity(uint32_t x)
+{
+    x ^= x >> 16;
+    x ^= x >> 8;
+    x ^= x >> 4;
+    return (0x6996U >> (x & 0x0FU)) & 0x01U;
+}
+
+/// <summary>
+/// Computes the syndrome of a packed codeword and flips the bit it points at.
+/// </summary>
+/// <param name="d">Packed codeword.</param>
+/// <param name="masks">Parity check masks.</param>
+/// <param name="checks">Number of check bits.</param>
+/// <param name="errors">Error mask for each syndrome.</param>
+/// <returns>Syndrome of the codeword.</returns>
+static inline uint32_t correct(uint32_t& d, const uint32_t* masks, uint32_t checks, const uint32_t* errors)
+{
+    uint32_t n = 0U;
+    for (uint32_t i = 0U; i < checks; i++)
+        n |= parity(d & masks[i]) << i;
+
+    d ^= errors[n];
+    return n;
+}
+
+/// <summary>
+/// Recomputes the check bits of a packed codeword.
+/// </summary>
+/// <param name="d">Packed codeword.</param>
+/// <param name="masks">Parity check masks.</param>
+/// <param name="checks">Number of check bits.</param>
+/// <returns>Packed codeword with the check bits set.</returns>
+static inline uint32_t encode(uint32_t d, const uint32_t* masks, uint32_t checks)
+{
+    d &= ~((1U << checks) - 1U);
+    for (uint32_t i = 0U; i < checks; i++)
+        d |= parity(d & masks[i]) << (checks - 1U - i);
+
+    return d;
+}
+
+/// <summary>
+/// Packs a boolean bit array into a word, with d[0] in the most significant bit.
+/// </summary>
+/// <param name="d">Boolean bit array.</param>
+/// <param name="length">Number of bits.</param>
+/// <returns></returns>
+static inline uint32_t pack(const bool* d, uint32_t length)
+{
+    uint32_t w = 0U;
+    for (uint32_t i = 0U; i < length; i++)
+        w = (w << 1) | (d[i] ? 1U : 0U);
+
+    return w;
+}
+
+/// <summary>
+/// Unpacks a word into a boolean bit array, with d[0] from the most significant bit.
+/// </summary>
+/// <param name="w">Packed word.</param>
+/// <param name="d">Boolean bit array.</param>
+/// <param name="length">Number of bits.</param>
+static inline void unpack(uint32_t w, bool* d, uint32_t length)
+{
+    for (uint32_t i = 0U; i < length; i++)
+        d[i] = ((w >> (length - 1U - i)) & 0x01U) == 0x01U;
+}
+
 // ---------------------------------------------------------------------------
 //  Static Class Members
 // ---------------------------------------------------------------------------
@@ -31,41 +152,47 @@ bool Hamming::decode15113_1(bool* d)
 {
     assert(d != nullptr);
 
-    // Calculate the parity it should have
-    bool c0 = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[5] ^ d[6];
-    bool c1 = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[7] ^ d[8] ^ d[9];
-    bool c2 = d[0] ^ d[1] ^ d[4] ^ d[5] ^ d[7] ^ d[8] ^ d[10];
-    bool c3 = d[0] ^ d[2] ^ d[4] ^ d[6] ^ d[7] ^ d[9] ^ d[10];
-
-    unsigned char n = 0U;
-    n |= (c0 != d[11]) ? 0x01U : 0x00U;
-    n |= (c1 != d[12]) ? 0x02U : 0x00U;
-    n |= (c2 != d[13]) ? 0x04U : 0x00U;
-    n |= (c3 != d[14]) ? 0x08U : 0x00U;
-
-    switch (n) {
-        // Parity bit errors
-        case 0x01U: d[11] = !d[11]; return true;
-        case 0x02U: d[12] = !d[12]; return true;
-        case 0x04U: d[13] = !d[13]; return true;
-        case 0x08U: d[14] = !d[14]; return true;
-
-        // Data bit errors
-        case 0x0FU: d[0] = !d[0];  return true;
-        case 0x07U: d[1] = !d[1];  return true;
-        case 0x0BU: d[2] = !d[2];  return true;
-        case 0x03U: d[3] = !d[3];  return true;
-        case 0x0DU: d[4] = !d[4];  return true;
-        case 0x05U: d[5] = !d[5];  return true;
-        case 0x09U: d[6] = !d[6];  return true;
-        case 0x0EU: d[7] = !d[7];  return true;
-        case 0x06U: d[8] = !d[8];  return true;
-        case 0x0AU: d[9] = !d[9];  return true;
-        case 0x0CU: d[10] = !d[10]; return true;
-
-        // No bit errors
-        default: return false;
+    uint16_t w = (uint16_t)pack(d, 15U);
+    bool ret = decode15113_1(w);
+    unpack(w, d, 15U);
+
+    return ret;
+}
+
+/// <summary>
+/// Decode Hamming (15,11,3) on a packed word.
+/// </summary>
+/// <param name="d">15-bit codeword; bit 14 holds d[0] and bit 0 holds d[14].</param>
+/// <returns>True, if bit errors are detected, otherwise false.</returns>
+bool Hamming::decode15113_1(uint16_t& d)
+{
+    uint32_t w = d;
+    uint32_t n = correct(w, PARITY_MASK_15113_1, 4U, ERROR_MASK_15113_1);
+    d = (uint16_t)w;
+
+    return ERROR_MASK_15113_1[n] != 0U;
+}
+
+/// <summary>
+/// Decode an array of Hamming (15,11,3) packed words.
+/// </summary>
+/// <param name="d">15-bit codewords; bit 14 holds d[0] and bit 0 holds d[14].</param>
+/// <param name="count">Number of codewords.</param>
+/// <returns>Count of codewords with bit errors corrected.</returns>
+uint32_t Hamming::decode15113_1(uint16_t* d, uint32_t count)
+{
+    assert(d != nullptr);
+
+    uint32_t ret = 0U;
+    for (uint32_t i = 0U; i < count; i++) {
+        uint32_t w = d[i];
+        uint32_t n = correct(w, PARITY_MASK_15113_1, 4U, ERROR_MASK_15113_1);
+        d[i] = (uint16_t)w;
+
+        ret += (ERROR_MASK_15113_1[n] != 0U) ? 1U : 0U;
     }
+
+    return ret;
 }
 
 /// <summary>
@@ -76,11 +203,18 @@ void Hamming::encode15113_1(bool* d)
 {
     assert(d != nullptr);
 
-    // Calculate the checksum this row should have
-    d[11] = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[5] ^ d[6];
-    d[12] = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[7] ^ d[8] ^ d[9];
-    d[13] = d[0] ^ d[1] ^ d[4] ^ d[5] ^ d[7] ^ d[8] ^ d[10];
-    d[14] = d[0] ^ d[2] ^ d[4] ^ d[6] ^ d[7] ^ d[9] ^ d[10];
+    uint16_t w = (uint16_t)pack(d, 15U);
+    encode15113_1(w);
+    unpack(w, d, 15U);
+}
+
+/// <summary>
+/// Encode Hamming (15,11,3) on a packed word.
+/// </summary>
+/// <param name="d">15-bit codeword; bit 14 holds d[0] and bit 0 holds d[14].</param>
+void Hamming::encode15113_1(uint16_t& d)
+{
+    d = (uint16_t)encode(d, PARITY_MASK_15113_1, 4U);
 }
 
 /// <summary>
@@ -92,41 +226,47 @@ bool Hamming::decode15113_2(bool* d)
 {
     assert(d != nullptr);
 
-    // Calculate the checksum this row should have
-    bool c0 = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[5] ^ d[7] ^ d[8];
-    bool c1 = d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[6] ^ d[8] ^ d[9];
-    bool c2 = d[2] ^ d[3] ^ d[4] ^ d[5] ^ d[7] ^ d[9] ^ d[10];
-    bool c3 = d[0] ^ d[1] ^ d[2] ^ d[4] ^ d[6] ^ d[7] ^ d[10];
-
-    unsigned char n = 0x00U;
-    n |= (c0 != d[11]) ? 0x01U : 0x00U;
-    n |= (c1 != d[12]) ? 0x02U : 0x00U;
-    n |= (c2 != d[13]) ? 0x04U : 0x00U;
-    n |= (c3 != d[14]) ? 0x08U : 0x00U;
-
-    switch (n) {
-        // Parity bit errors
-        case 0x01U: d[11] = !d[11]; return true;
-        case 0x02U: d[12] = !d[12]; return true;
-        case 0x04U: d[13] = !d[13]; return true;
-        case 0x08U: d[14] = !d[14]; return true;
-
-        // Data bit errors
-        case 0x09U: d[0] = !d[0];  return true;
-        case 0x0BU: d[1] = !d[1];  return true;
-        case 0x0FU: d[2] = !d[2];  return true;
-        case 0x07U: d[3] = !d[3];  return true;
-        case 0x0EU: d[4] = !d[4];  return true;
-        case 0x05U: d[5] = !d[5];  return true;
-        case 0x0AU: d[6] = !d[6];  return true;
-        case 0x0DU: d[7] = !d[7];  return true;
-        case 0x03U: d[8] = !d[8];  return true;
-        case 0x06U: d[9] = !d[9];  return true;
-        case 0x0CU: d[10] = !d[10]; return true;
-
-        // No bit errors
-        default: return false;
+    uint16_t w = (uint16_t)pack(d, 15U);
+    bool ret = decode15113_2(w);
+    unpack(w, d, 15U);
+
+    return ret;
+}
+
+/// <summary>
+/// Decode Hamming (15,11,3) on a packed word.
+/// </summary>
+/// <param name="d">15-bit codeword; bit 14 holds d[0] and bit 0 holds d[14].</param>
+/// <returns>True, if bit errors are detected, otherwise false.</returns>
+bool Hamming::decode15113_2(uint16_t& d)
+{
+    uint32_t w = d;
+    uint32_t n = correct(w, PARITY_MASK_15113_2, 4U, ERROR_MASK_15113_2);
+    d = (uint16_t)w;
+
+    return ERROR_MASK_15113_2[n] != 0U;
+}
+
+/// <summary>
+/// Decode an array of Hamming (15,11,3) packed words.
+/// </summary>
+/// <param name="d">15-bit codewords; bit 14 holds d[0] and bit 0 holds d[14].</param>
+/// <param name="count">Number of codewords.</param>
+/// <returns>Count of codewords with bit errors corrected.</returns>
+uint32_t Hamming::decode15113_2(uint16_t* d, uint32_t count)
+{
+    assert(d != nullptr);
+
+    uint32_t ret = 0U;
+    for (uint32_t i = 0U; i < count; i++) {
+        uint32_t w = d[i];
+        uint32_t n = correct(w, PARITY_MASK_15113_2, 4U, ERROR_MASK_15113_2);
+        d[i] = (uint16_t)w;
+
+        ret += (ERROR_MASK_15113_2[n] != 0U) ? 1U : 0U;
     }
+
+    return ret;
 }
 
 /// <summary>
@@ -137,11 +277,18 @@ void Hamming::encode15113_2(bool* d)
 {
     assert(d != nullptr);
 
-    // Calculate the checksum this row should have
-    d[11] = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[5] ^ d[7] ^ d[8];
-    d[12] = d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[6] ^ d[8] ^ d[9];
-    d[13] = d[2] ^ d[3] ^ d[4] ^ d[5] ^ d[7] ^ d[9] ^ d[10];
-    d[14] = d[0] ^ d[1] ^ d[2] ^ d[4] ^ d[6] ^ d[7] ^ d[10];
+    uint16_t w = (uint16_t)pack(d, 15U);
+    encode15113_2(w);
+    unpack(w, d, 15U);
+}
+
+/// <summary>
+/// Encode Hamming (15,11,3) on a packed word.
+/// </summary>
+/// <param name="d">15-bit codeword; bit 14 holds d[0] and bit 0 holds d[14].</param>
+void Hamming::encode15113_2(uint16_t& d)
+{
+    d = (uint16_t)encode(d, PARITY_MASK_15113_2, 4U);
 }
 
 /// <summary>
@@ -153,39 +300,47 @@ bool Hamming::decode1393(bool* d)
 {
     assert(d != nullptr);
 
-    // Calculate the checksum this column should have
-    bool c0 = d[0] ^ d[1] ^ d[3] ^ d[5] ^ d[6];
-    bool c1 = d[0] ^ d[1] ^ d[2] ^ d[4] ^ d[6] ^ d[7];
-    bool c2 = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[5] ^ d[7] ^ d[8];
-    bool c3 = d[0] ^ d[2] ^ d[4] ^ d[5] ^ d[8];
-
-    unsigned char n = 0x00U;
-    n |= (c0 != d[9]) ? 0x01U : 0x00U;
-    n |= (c1 != d[10]) ? 0x02U : 0x00U;
-    n |= (c2 != d[11]) ? 0x04U : 0x00U;
-    n |= (c3 != d[12]) ? 0x08U : 0x00U;
-
-    switch (n) {
-        // Parity bit errors
-        case 0x01U: d[9] = !d[9];  return true;
-        case 0x02U: d[10] = !d[10]; return true;
-        case 0x04U: d[11] = !d[11]; return true;
-        case 0x08U: d[12] = !d[12]; return true;
-
-        // Data bit erros
-        case 0x0FU: d[0] = !d[0]; return true;
-        case 0x07U: d[1] = !d[1]; return true;
-        case 0x0EU: d[2] = !d[2]; return true;
-        case 0x05U: d[3] = !d[3]; return true;
-        case 0x0AU: d[4] = !d[4]; return true;
-        case 0x0DU: d[5] = !d[5]; return true;
-        case 0x03U: d[6] = !d[6]; return true;
-        case 0x06U: d[7] = !d[7]; return true;
-        case 0x0CU: d[8] = !d[8]; return true;
-
-        // No bit errors
-        default: return false;
+    uint16_t w = (uint16_t)pack(d, 13U);
+    bool ret = decode1393(w);
+    unpack(w, d, 13U);
+
+    return ret;
+}
+
+/// <summary>
+/// Decode Hamming (13,9,3) on a packed word.
+/// </summary>
+/// <param name="d">13-bit codeword; bit 12 holds d[0] and bit 0 holds d[12].</param>
+/// <returns>True, if bit errors are detected, otherwise false.</returns>
+bool Hamming::decode1393(uint16_t& d)
+{
+    uint32_t w = d;
+    uint32_t n = correct(w, PARITY_MASK_1393, 4U, ERROR_MASK_1393);
+    d = (uint16_t)w;
+
+    return ERROR_MASK_1393[n] != 0U;
+}
+
+/// <summary>
+/// Decode an array of Hamming (13,9,3) packed words.
+/// </summary>
+/// <param name="d">13-bit codewords; bit 12 holds d[0] and bit 0 holds d[12].</param>
+/// <param name="count">Number of codewords.</param>
+/// <returns>Count of codewords with bit errors corrected.</returns>
+uint32_t Hamming::decode1393(uint16_t* d, uint32_t count)
+{
+    assert(d != nullptr);
+
+    uint32_t ret = 0U;
+    for (uint32_t i = 0U; i < count; i++) {
+        uint32_t w = d[i];
+        uint32_t n = correct(w, PARITY_MASK_1393, 4U, ERROR_MASK_1393);
+        d[i] = (uint16_t)w;
+
+        ret += (ERROR_MASK_1393[n] != 0U) ? 1U : 0U;
     }
+
+    return ret;
 }
 
 /// <summary>
@@ -196,11 +351,18 @@ void Hamming::encode1393(bool* d)
 {
     assert(d != nullptr);
 
-    // Calculate the checksum this column should have
-    d[9] = d[0] ^ d[1] ^ d[3] ^ d[5] ^ d[6];
-    d[10] = d[0] ^ d[1] ^ d[2] ^ d[4] ^ d[6] ^ d[7];
-    d[11] = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[5] ^ d[7] ^ d[8];
-    d[12] = d[0] ^ d[2] ^ d[4] ^ d[5] ^ d[8];
+    uint16_t w = (uint16_t)pack(d, 13U);
+    encode1393(w);
+    unpack(w, d, 13U);
+}
+
+/// <summary>
+/// Encode Hamming (13,9,3) on a packed word.
+/// </summary>
+/// <param name="d">13-bit codeword; bit 12 holds d[0] and bit 0 holds d[12].</param>
+void Hamming::encode1393(uint16_t& d)
+{
+    d = (uint16_t)encode(d, PARITY_MASK_1393, 4U);
 }
 
 /// <summary>
@@ -212,36 +374,47 @@ bool Hamming::decode1063(bool* d)
 {
     assert(d != nullptr);
 
-    // Calculate the checksum this column should have
-    bool c0 = d[0] ^ d[1] ^ d[2] ^ d[5];
-    bool c1 = d[0] ^ d[1] ^ d[3] ^ d[5];
-    bool c2 = d[0] ^ d[2] ^ d[3] ^ d[4];
-    bool c3 = d[1] ^ d[2] ^ d[3] ^ d[4];
-
-    unsigned char n = 0x00U;
-    n |= (c0 != d[6]) ? 0x01U : 0x00U;
-    n |= (c1 != d[7]) ? 0x02U : 0x00U;
-    n |= (c2 != d[8]) ? 0x04U : 0x00U;
-    n |= (c3 != d[9]) ? 0x08U : 0x00U;
-
-    switch (n) {
-        // Parity bit errors
-        case 0x01U: d[6] = !d[6]; return true;
-        case 0x02U: d[7] = !d[7]; return true;
-        case 0x04U: d[8] = !d[8]; return true;
-        case 0x08U: d[9] = !d[9]; return true;
-
-        // Data bit erros
-        case 0x07U: d[0] = !d[0]; return true;
-        case 0x0BU: d[1] = !d[1]; return true;
-        case 0x0DU: d[2] = !d[2]; return true;
-        case 0x0EU: d[3] = !d[3]; return true;
-        case 0x0CU: d[4] = !d[4]; return true;
-        case 0x03U: d[5] = !d[5]; return true;
-
-        // No bit errors
-        default: return false;
+    uint16_t w = (uint16_t)pack(d, 10U);
+    bool ret = decode1063(w);
+    unpack(w, d, 10U);
+
+    return ret;
+}
+
+/// <summary>
+/// Decode Hamming (10,6,3) on a packed word.
+/// </summary>
+/// <param name="d">10-bit codeword; bit 9 holds d[0] and bit 0 holds d[9].</param>
+/// <returns>True, if bit errors are detected, otherwise false.</returns>
+bool Hamming::decode1063(uint16_t& d)
+{
+    uint32_t w = d;
+    uint32_t n = correct(w, PARITY_MASK_1063, 4U, ERROR_MASK_1063);
+    d = (uint16_t)w;
+
+    return ERROR_MASK_1063[n] != 0U;
+}
+
+/// <summary>
+/// Decode an array of Hamming (10,6,3) packed words.
+/// </summary>
+/// <param name="d">10-bit codewords; bit 9 holds d[0] and bit 0 holds d[9].</param>
+/// <param name="count">Number of codewords.</param>
+/// <returns>Count of codewords with bit errors corrected.</returns>
+uint32_t Hamming::decode1063(uint16_t* d, uint32_t count)
+{
+    assert(d != nullptr);
+
+    uint32_t ret = 0U;
+    for (uint32_t i = 0U; i < count; i++) {
+        uint32_t w = d[i];
+        uint32_t n = correct(w, PARITY_MASK_1063, 4U, ERROR_MASK_1063);
+        d[i] = (uint16_t)w;
+
+        ret += (ERROR_MASK_1063[n] != 0U) ? 1U : 0U;
     }
+
+    return ret;
 }
 
 /// <summary>
@@ -252,11 +425,18 @@ void Hamming::encode1063(bool* d)
 {
     assert(d != nullptr);
 
-    // Calculate the checksum this column should have
-    d[6] = d[0] ^ d[1] ^ d[2] ^ d[5];
-    d[7] = d[0] ^ d[1] ^ d[3] ^ d[5];
-    d[8] = d[0] ^ d[2] ^ d[3] ^ d[4];
-    d[9] = d[1] ^ d[2] ^ d[3] ^ d[4];
+    uint16_t w = (uint16_t)pack(d, 10U);
+    encode1063(w);
+    unpack(w, d, 10U);
+}
+
+/// <summary>
+/// Encode Hamming (10,6,3) on a packed word.
+/// </summary>
+/// <param name="d">10-bit codeword; bit 9 holds d[0] and bit 0 holds d[9].</param>
+void Hamming::encode1063(uint16_t& d)
+{
+    d = (uint16_t)encode(d, PARITY_MASK_1063, 4U);
 }
 
 /// <summary>
@@ -268,63 +448,69 @@ bool Hamming::decode16114(bool* d)
 {
     assert(d != nullptr);
 
-    // Calculate the checksum this column should have
-    bool c0 = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[5] ^ d[7] ^ d[8];
-    bool c1 = d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[6] ^ d[8] ^ d[9];
-    bool c2 = d[2] ^ d[3] ^ d[4] ^ d[5] ^ d[7] ^ d[9] ^ d[10];
-    bool c3 = d[0] ^ d[1] ^ d[2] ^ d[4] ^ d[6] ^ d[7] ^ d[10];
-    bool c4 = d[0] ^ d[2] ^ d[5] ^ d[6] ^ d[8] ^ d[9] ^ d[10];
-
-    // Compare these with the actual bits
-    unsigned char n = 0x00U;
-    n |= (c0 != d[11]) ? 0x01U : 0x00U;
-    n |= (c1 != d[12]) ? 0x02U : 0x00U;
-    n |= (c2 != d[13]) ? 0x04U : 0x00U;
-    n |= (c3 != d[14]) ? 0x08U : 0x00U;
-    n |= (c4 != d[15]) ? 0x10U : 0x00U;
-
-    switch (n) {
-        // Parity bit errors
-        case 0x01U: d[11] = !d[11]; return true;
-        case 0x02U: d[12] = !d[12]; return true;
-        case 0x04U: d[13] = !d[13]; return true;
-        case 0x08U: d[14] = !d[14]; return true;
-        case 0x10U: d[15] = !d[15]; return true;
-
-        // Data bit errors
-        case 0x19U: d[0] = !d[0];  return true;
-        case 0x0BU: d[1] = !d[1];  return true;
-        case 0x1FU: d[2] = !d[2];  return true;
-        case 0x07U: d[3] = !d[3];  return true;
-        case 0x0EU: d[4] = !d[4];  return true;
-        case 0x15U: d[5] = !d[5];  return true;
-        case 0x1AU: d[6] = !d[6];  return true;
-        case 0x0DU: d[7] = !d[7];  return true;
-        case 0x13U: d[8] = !d[8];  return true;
-        case 0x16U: d[9] = !d[9];  return true;
-        case 0x1CU: d[10] = !d[10]; return true;
-
-        // No bit errors
-        case 0x00U: return true;
-
-        // Unrecoverable errors
-        default: return false;
+    uint16_t w = (uint16_t)pack(d, 16U);
+    bool ret = decode16114(w);
+    unpack(w, d, 16U);
+
+    return ret;
+}
+
+/// <summary>
+/// Decode Hamming (16,11,4) on a packed word.
+/// </summary>
+/// <param name="d">16-bit codeword; bit 15 holds d[0] and bit 0 holds d[15].</param>
+/// <returns>True, if bit errors are detected or no bit errors, otherwise false if unrecoverable errors are detected.</returns>
+bool Hamming::decode16114(uint16_t& d)
+{
+    uint32_t w = d;
+    uint32_t n = correct(w, PARITY_MASK_16114, 5U, ERROR_MASK_16114);
+    d = (uint16_t)w;
+
+    return (n == 0U) || (ERROR_MASK_16114[n] != 0U);
+}
+
+/// <summary>
+/// Decode an array of Hamming (16,11,4) packed words.
+/// </summary>
+/// <param name="d">16-bit codewords; bit 15 holds d[0] and bit 0 holds d[15].</param>
+/// <param name="count">Number of codewords.</param>
+/// <returns>Count of codewords without unrecoverable errors.</returns>
+uint32_t Hamming::decode16114(uint16_t* d, uint32_t count)
+{
+    assert(d != nullptr);
+
+    uint32_t ret = 0U;
+    for (uint32_t i = 0U; i < count; i++) {
+        uint32_t w = d[i];
+        uint32_t n = correct(w, PARITY_MASK_16114, 5U, ERROR_MASK_16114);
+        d[i] = (uint16_t)w;
+
+        ret += ((n == 0U) || (ERROR_MASK_16114[n] != 0U)) ? 1U : 0U;
     }
+
+    return ret;
 }
 
 /// <summary>
-/// Encode Hamming (10,6,3).
+/// Encode Hamming (16,11,4).
 /// </summary>
 /// <param name="d">Boolean bit array.</param>
 void Hamming::encode16114(bool* d)
 {
     assert(d != nullptr);
 
-    d[11] = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[5] ^ d[7] ^ d[8];
-    d[12] = d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[6] ^ d[8] ^ d[9];
-    d[13] = d[2] ^ d[3] ^ d[4] ^ d[5] ^ d[7] ^ d[9] ^ d[10];
-    d[14] = d[0] ^ d[1] ^ d[2] ^ d[4] ^ d[6] ^ d[7] ^ d[10];
-    d[15] = d[0] ^ d[2] ^ d[5] ^ d[6] ^ d[8] ^ d[9] ^ d[10];
+    uint16_t w = (uint16_t)pack(d, 16U);
+    encode16114(w);
+    unpack(w, d, 16U);
+}
+
+/// <summary>
+/// Encode Hamming (16,11,4) on a packed word.
+/// </summary>
+/// <param name="d">16-bit codeword; bit 15 holds d[0] and bit 0 holds d[15].</param>
+void Hamming::encode16114(uint16_t& d)
+{
+    d = (uint16_t)encode(d, PARITY_MASK_16114, 5U);
 }
 
 /// <summary>
@@ -336,49 +522,47 @@ bool Hamming::decode17123(bool* d)
 {
     assert(d != nullptr);
 
-    // Calculate the checksum this column should have
-    bool c0 = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[6] ^ d[7] ^ d[9];
-    bool c1 = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[7] ^ d[8] ^ d[10];
-    bool c2 = d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[5] ^ d[8] ^ d[9] ^ d[11];
-    bool c3 = d[0] ^ d[1] ^ d[4] ^ d[5] ^ d[7] ^ d[10];
-    bool c4 = d[0] ^ d[1] ^ d[2] ^ d[5] ^ d[6] ^ d[8] ^ d[11];
-
-    // Compare these with the actual bits
-    unsigned char n = 0x00U;
-    n |= (c0 != d[12]) ? 0x01U : 0x00U;
-    n |= (c1 != d[13]) ? 0x02U : 0x00U;
-    n |= (c2 != d[14]) ? 0x04U : 0x00U;
-    n |= (c3 != d[15]) ? 0x08U : 0x00U;
-    n |= (c4 != d[16]) ? 0x10U : 0x00U;
-
-    switch (n) {
-        // Parity bit errors
-        case 0x01U: d[12] = !d[12]; return true;
-        case 0x02U: d[13] = !d[13]; return true;
-        case 0x04U: d[14] = !d[14]; return true;
-        case 0x08U: d[15] = !d[15]; return true;
-        case 0x10U: d[16] = !d[16]; return true;
-
-        // Data bit errors
-        case 0x1BU: d[0] = !d[0];  return true;
-        case 0x1FU: d[1] = !d[1];  return true;
-        case 0x17U: d[2] = !d[2];  return true;
-        case 0x07U: d[3] = !d[3];  return true;
-        case 0x0EU: d[4] = !d[4];  return true;
-        case 0x1CU: d[5] = !d[5];  return true;
-        case 0x11U: d[6] = !d[6];  return true;
-        case 0x0BU: d[7] = !d[7];  return true;
-        case 0x16U: d[8] = !d[8];  return true;
-        case 0x05U: d[9] = !d[9];  return true;
-        case 0x0AU: d[10] = !d[10]; return true;
-        case 0x14U: d[11] = !d[11]; return true;
-
-        // No bit errors
-        case 0x00U: return true;
-
-        // Unrecoverable errors
-        default: return false;
+    uint32_t w = pack(d, 17U);
+    bool ret = decode17123(w);
+    unpack(w, d, 17U);
+
+    return ret;
+}
+
+/// <summary>
+/// Decode Hamming (17,12,3) on a packed word.
+/// </summary>
+/// <param name="d">17-bit codeword; bit 16 holds d[0] and bit 0 holds d[16].</param>
+/// <returns>True, if bit errors are detected or no bit errors, otherwise false if unrecoverable errors are detected.</returns>
+bool Hamming::decode17123(uint32_t& d)
+{
+    uint32_t w = d;
+    uint32_t n = correct(w, PARITY_MASK_17123, 5U, ERROR_MASK_17123);
+    d = w;
+
+    return (n == 0U) || (ERROR_MASK_17123[n] != 0U);
+}
+
+/// <summary>
+/// Decode an array of Hamming (17,12,3) packed words.
+/// </summary>
+/// <param name="d">17-bit codewords; bit 16 holds d[0] and bit 0 holds d[16].</param>
+/// <param name="count">Number of codewords.</param>
+/// <returns>Count of codewords without unrecoverable errors.</returns>
+uint32_t Hamming::decode17123(uint32_t* d, uint32_t count)
+{
+    assert(d != nullptr);
+
+    uint32_t ret = 0U;
+    for (uint32_t i = 0U; i < count; i++) {
+        uint32_t w = d[i];
+        uint32_t n = correct(w, PARITY_MASK_17123, 5U, ERROR_MASK_17123);
+        d[i] = w;
+
+        ret += ((n == 0U) || (ERROR_MASK_17123[n] != 0U)) ? 1U : 0U;
     }
+
+    return ret;
 }
 
 /// <summary>
@@ -389,9 +573,16 @@ void Hamming::encode17123(bool* d)
 {
     assert(d != nullptr);
 
-    d[12] = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[6] ^ d[7] ^ d[9];
-    d[13] = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[7] ^ d[8] ^ d[10];
-    d[14] = d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[5] ^ d[8] ^ d[9] ^ d[11];
-    d[15] = d[0] ^ d[1] ^ d[4] ^ d[5] ^ d[7] ^ d[10];
-    d[16] = d[0] ^ d[1] ^ d[2] ^ d[5] ^ d[6] ^ d[8] ^ d[11];
+    uint32_t w = pack(d, 17U);
+    encode17123(w);
+    unpack(w, d, 17U);
+}
+
+/// <summary>
+/// Encode Hamming (17,12,3) on a packed word.
+/// </summary>
+/// <param name="d">17-bit codeword; bit 16 holds d[0] and bit 0 holds d[16].</param>
+void Hamming::encode17123(uint32_t& d)
+{
+    d = encode(d, PARITY_MASK_17123, 5U);
 }
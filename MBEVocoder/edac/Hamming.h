@@ -28,33 +28,69 @@ namespace edac
     public:
         /// <summary>Decode Hamming (15,11,3).</summary>
         static bool decode15113_1(bool* d);
+        /// <summary>Decode Hamming (15,11,3) on a packed word.</summary>
+        static bool decode15113_1(uint16_t& d);
+        /// <summary>Decode an array of Hamming (15,11,3) packed words.</summary>
+        static uint32_t decode15113_1(uint16_t* d, uint32_t count);
         /// <summary>Encode Hamming (15,11,3).</summary>
         static void encode15113_1(bool* d);
+        /// <summary>Encode Hamming (15,11,3) on a packed word.</summary>
+        static void encode15113_1(uint16_t& d);
 
         /// <summary>Decode Hamming (15,11,3).</summary>
         static bool decode15113_2(bool* d);
+        /// <summary>Decode Hamming (15,11,3) on a packed word.</summary>
+        static bool decode15113_2(uint16_t& d);
+        /// <summary>Decode an array of Hamming (15,11,3) packed words.</summary>
+        static uint32_t decode15113_2(uint16_t* d, uint32_t count);
         /// <summary>Encode Hamming (15,11,3).</summary>
         static void encode15113_2(bool* d);
+        /// <summary>Encode Hamming (15,11,3) on a packed word.</summary>
+        static void encode15113_2(uint16_t& d);
 
         /// <summary>Decode Hamming (13,9,3).</summary>
         static bool decode1393(bool* d);
+        /// <summary>Decode Hamming (13,9,3) on a packed word.</summary>
+        static bool decode1393(uint16_t& d);
+        /// <summary>Decode an array of Hamming (13,9,3) packed words.</summary>
+        static uint32_t decode1393(uint16_t* d, uint32_t count);
         /// <summary>Encode Hamming (13,9,3).</summary>
         static void encode1393(bool* d);
+        /// <summary>Encode Hamming (13,9,3) on a packed word.</summary>
+        static void encode1393(uint16_t& d);
 
         /// <summary>Decode Hamming (10,6,3).</summary>
         static bool decode1063(bool* d);
+        /// <summary>Decode Hamming (10,6,3) on a packed word.</summary>
+        static bool decode1063(uint16_t& d);
+        /// <summary>Decode an array of Hamming (10,6,3) packed words.</summary>
+        static uint32_t decode1063(uint16_t* d, uint32_t count);
         /// <summary>Encode Hamming (10,6,3).</summary>
         static void encode1063(bool* d);
+        /// <summary>Encode Hamming (10,6,3) on a packed word.</summary>
+        static void encode1063(uint16_t& d);
 
         /// <summary>Decode Hamming (16,11,4).</summary>
         static bool decode16114(bool* d);
+        /// <summary>Decode Hamming (16,11,4) on a packed word.</summary>
+        static bool decode16114(uint16_t& d);
+        /// <summary>Decode an array of Hamming (16,11,4) packed words.</summary>
+        static uint32_t decode16114(uint16_t* d, uint32_t count);
         /// <summary>Encode Hamming (16,11,4).</summary>
         static void encode16114(bool* d);
+        /// <summary>Encode Hamming (16,11,4) on a packed word.</summary>
+        static void encode16114(uint16_t& d);
 
         /// <summary>Decode Hamming (17,12,3).</summary>
         static bool decode17123(bool* d);
+        /// <summary>Decode Hamming (17,12,3) on a packed word.</summary>
+        static bool decode17123(uint32_t& d);
+        /// <summary>Decode an array of Hamming (17,12,3) packed words.</summary>
+        static uint32_t decode17123(uint32_t* d, uint32_t count);
         /// <summary>Encode Hamming (17,12,3).</summary>
         static void encode17123(bool* d);
+        /// <summary>Encode Hamming (17,12,3) on a packed word.</summary>
+        static void encode17123(uint32_t& d);
     };
 } // namespace edac
 
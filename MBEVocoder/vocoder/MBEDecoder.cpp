@@ -12,11 +12,19 @@
 *
 */
 #include <iostream>
+#include <cassert>
 #include <string.h>
 #include <math.h>
 
+#include "edac/AMBEFEC.h"
 #include "edac/Golay24128.h"
 #include "vocoder/MBEDecoder.h"
+#include "Utils.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define OUTPUT_STAGE_SSE2
+#endif
 
 using namespace edac;
 using namespace vocoder;
@@ -66,6 +74,132 @@ const int MBEDecoder::rZ[36] = {
     13, 2, 12, 1, 11, 0
 };
 
+// output samples are clipped to this level
+static const float CLIP_LEVEL = 32760.0f;
+// float output samples are scaled by this level, as PCMOps::samplesToFloat() scales 16-bit samples
+static const float OUTPUT_SCALE = 32768.0f;
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/// <summary>
+/// Returns the peak absolute level of 160 PCM samples.
+/// </summary>
+/// <param name="samples">160 PCM samples.</param>
+/// <param name="vector">Flag indicating the SIMD path is used.</param>
+/// <returns></returns>
+static float peakLevel(const float* samples, bool vector)
+{
+    float max = 0.0f;
+#if defined(OUTPUT_STAGE_SSE2)
+    if (vector) {
+        // clearing the sign bit gives fabsf(); max_ps keeps the running max when a sample is NaN,
+        // as the scalar comparison does
+        const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+        __m128 max0 = _mm_setzero_ps(), max1 = _mm_setzero_ps();
+        for (uint32_t n = 0U; n < 160U; n += 8U) {
+            max0 = _mm_max_ps(_mm_and_ps(_mm_loadu_ps(samples + n), absMask), max0);
+            max1 = _mm_max_ps(_mm_and_ps(_mm_loadu_ps(samples + n + 4U), absMask), max1);
+        }
+
+        max0 = _mm_max_ps(max0, max1);
+        max0 = _mm_max_ps(max0, _mm_movehl_ps(max0, max0));
+        max0 = _mm_max_ss(max0, _mm_shuffle_ps(max0, max0, 0x01));
+        return _mm_cvtss_f32(max0);
+    }
+#endif
+    for (uint32_t n = 0U; n < 160U; n++) {
+        float out = fabsf(samples[n]);
+        if (out > max) {
+            max = out;
+        }
+    }
+
+    return max;
+}
+
+/// <summary>
+/// Applies a linear gain ramp to 160 PCM samples, clips them and converts them to 16-bit.
+/// </summary>
+/// <remarks>
+/// Each output sample is (gain + (n * gainDelta)) * sample, evaluated in the same order on
+/// both paths so the SIMD output is bit-exact with the scalar output.
+/// </remarks>
+/// <param name="samplesF">160 decoded PCM samples.</param>
+/// <param name="gain">Gain of the first sample.</param>
+/// <param name="gainDelta">Gain step per sample.</param>
+/// <param name="samples">160 PCM samples.</param>
+/// <param name="vector">Flag indicating the SIMD path is used.</param>
+static void outputSamples(const float* samplesF, float gain, float gainDelta, int16_t* samples, bool vector)
+{
+#if defined(OUTPUT_STAGE_SSE2)
+    if (vector) {
+        const __m128 vGain = _mm_set1_ps(gain);
+        const __m128 vDelta = _mm_set1_ps(gainDelta);
+        const __m128 vClip = _mm_set1_ps(CLIP_LEVEL);
+        const __m128 vClipNeg = _mm_set1_ps(-CLIP_LEVEL);
+        const __m128 vStep = _mm_set1_ps(8.0f);
+
+        __m128 idx0 = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+        __m128 idx1 = _mm_setr_ps(4.0f, 5.0f, 6.0f, 7.0f);
+        for (uint32_t n = 0U; n < 160U; n += 8U) {
+            __m128 smp0 = _mm_mul_ps(_mm_add_ps(vGain, _mm_mul_ps(idx0, vDelta)), _mm_loadu_ps(samplesF + n));
+            __m128 smp1 = _mm_mul_ps(_mm_add_ps(vGain, _mm_mul_ps(idx1, vDelta)), _mm_loadu_ps(samplesF + n + 4U));
+
+            smp0 = _mm_max_ps(_mm_min_ps(smp0, vClip), vClipNeg);
+            smp1 = _mm_max_ps(_mm_min_ps(smp1, vClip), vClipNeg);
+
+            // the clipped samples are in range, so the saturating pack only narrows them
+            __m128i out = _mm_packs_epi32(_mm_cvttps_epi32(smp0), _mm_cvttps_epi32(smp1));
+            _mm_storeu_si128((__m128i*)(samples + n), out);
+
+            idx0 = _mm_add_ps(idx0, vStep);
+            idx1 = _mm_add_ps(idx1, vStep);
+        }
+
+        return;
+    }
+#endif
+    for (uint32_t n = 0U; n < 160U; n++) {
+        float smp = (gain + (static_cast<float>(n) * gainDelta)) * samplesF[n];
+
+        // audio clipping
+        if (smp > CLIP_LEVEL) {
+            smp = CLIP_LEVEL;
+        }
+        else if (smp < -CLIP_LEVEL) {
+            smp = -CLIP_LEVEL;
+        }
+
+        samples[n] = (int16_t)(smp);
+    }
+}
+
+/// <summary>
+/// Applies a linear gain ramp to 160 PCM samples, clips them and scales them to +/-1.0.
+/// </summary>
+/// <param name="samplesF">160 decoded PCM samples.</param>
+/// <param name="gain">Gain of the first sample.</param>
+/// <param name="gainDelta">Gain step per sample.</param>
+/// <param name="samples">160 float PCM samples.</param>
+static void outputSamplesF(const float* samplesF, float gain, float gainDelta, float* samples)
+{
+    for (uint32_t n = 0U; n < 160U; n++) {
+        float smp = (gain + (static_cast<float>(n) * gainDelta)) * samplesF[n];
+
+        // audio clipping
+        if (smp > CLIP_LEVEL) {
+            smp = CLIP_LEVEL;
+        }
+        else if (smp < -CLIP_LEVEL) {
+            smp = -CLIP_LEVEL;
+        }
+
+        samples[n] = smp / OUTPUT_SCALE;
+    }
+}
+
 // ---------------------------------------------------------------------------
 //  Public Class Members
 // ---------------------------------------------------------------------------
@@ -73,17 +207,28 @@ const int MBEDecoder::rZ[36] = {
 /// Initializes a new instance of the MBEDecoder class.
 /// </summary>
 /// <param name="mode"></param>
-MBEDecoder::MBEDecoder(MBE_DECODER_MODE mode) :
+MBEDecoder::MBEDecoder(MBE_DECODER_MODE mode, uint32_t sampleRate) :
     m_mbelibParms(NULL),
     m_mbeMode(mode),
-    m_gainAdjust(1.0f)
+    m_resampler(nullptr),
+    m_gainMaxHead(0U),
+    m_gainMaxCount(0U),
+    m_gainFrame(0U),
+    m_gainAdjust(1.0f),
+    m_autoGain(false),
+    m_vectorOutput(true),
+    m_sampleRate(sampleRate)
 {
     m_mbelibParms = new mbelibParms();
     mbe_initMbeParms(m_mbelibParms->m_cur_mp, m_mbelibParms->m_prev_mp, m_mbelibParms->m_prev_mp_enhanced);
 
-    ::memset(gainMaxBuf, 0, sizeof(float) * 200);
-    gainMaxBufPtr = gainMaxBuf;
-    gainMaxIdx = 0;
+    ::memset(m_gainMax, 0x00U, sizeof(m_gainMax));
+    ::memset(m_gainMaxFrame, 0x00U, sizeof(m_gainMaxFrame));
+
+    // an unsupported rate is kept as given; the stream decoder then refuses every codeword
+    assert(Resampler::isSupportedRate(sampleRate));
+    if (m_sampleRate != MBE_SAMPLE_RATE && Resampler::isSupportedRate(m_sampleRate))
+        m_resampler = new Resampler(MBE_SAMPLE_RATE, m_sampleRate);
 }
 
 /// <summary>
@@ -92,6 +237,7 @@ MBEDecoder::MBEDecoder(MBE_DECODER_MODE mode) :
 MBEDecoder::~MBEDecoder()
 {
     delete m_mbelibParms;
+    delete m_resampler;
 }
 
 /// <summary>
@@ -104,7 +250,7 @@ int32_t MBEDecoder::decodeBits(uint8_t* codeword, char* mbeBits)
 {
     int32_t errs = 0;
     float samples[160U];
-    ::memset(samples, 0x00U, 160U);
+    ::memset(samples, 0x00U, sizeof(samples));
 
     switch (m_mbeMode)
     {
@@ -142,6 +288,19 @@ int32_t MBEDecoder::decodeBits(uint8_t* codeword, char* mbeBits)
     }
     break;
 
+    case DECODE_NXDN_AMBE:
+    {
+        uint32_t a, b, c;
+        AMBEFEC::getNXDNFrame(codeword, a, b, c);
+
+        char ambe_d[1U][49U];
+        int ambeErrs;
+        decodeAMBE(&a, &b, &c, ambe_d, &ambeErrs, &errs, 1U);
+
+        ::memcpy(mbeBits, ambe_d[0U], 49U);
+    }
+    break;
+
     case DECODE_88BIT_IMBE:
     {
         char imbe_d[88U];
@@ -205,6 +364,22 @@ int32_t MBEDecoder::decodeF(uint8_t* codeword, float samples[])
     }
     break;
 
+    case DECODE_NXDN_AMBE:
+    {
+        uint32_t a, b, c;
+        AMBEFEC::getNXDNFrame(codeword, a, b, c);
+
+        char ambe_d[1U][49U];
+        int ambeErrs;
+        decodeAMBE(&a, &b, &c, ambe_d, &ambeErrs, &errs, 1U);
+
+        char ambeErrStr[64U];
+        ::memset(ambeErrStr, 0x20U, 64U);
+
+        mbe_processAmbe2450DataF(samples, &ambeErrs, &errs, ambeErrStr, ambe_d[0U], m_mbelibParms->m_cur_mp, m_mbelibParms->m_prev_mp, m_mbelibParms->m_prev_mp_enhanced, 3);
+    }
+    break;
+
     case DECODE_88BIT_IMBE:
     {
         char imbe_d[88U];
@@ -237,41 +412,219 @@ int32_t MBEDecoder::decodeF(uint8_t* codeword, float samples[])
 int32_t MBEDecoder::decode(uint8_t* codeword, int16_t samples[])
 {
     float samplesF[160U];
-    ::memset(samplesF, 0x00U, 160U);
+    ::memset(samplesF, 0x00U, sizeof(samplesF));
     int32_t errs = decodeF(codeword, samplesF);
 
-    float* sampleFPtr = samplesF;
-    if (m_autoGain) {
-        // detect max level
-        float max = 0.0f;
-        for (int n = 0; n < 160; n++) {
-            float out = fabsf(*sampleFPtr);
-            if (out > max) {
-                max = out;
-            }
+    gainSamples(samplesF, samples);
 
-            sampleFPtr++;
-        }
+    return errs;
+}
 
-        *gainMaxBufPtr = max;
-        gainMaxBufPtr++;
-        gainMaxIdx++;
+/// <summary>
+/// Decodes the three AMBE frames of a DMR voice burst to PCM samples.
+/// </summary>
+/// <remarks>
+/// The a/b/c words of all three frames are extracted from the burst in one pass and the C0
+/// and C1 Golay words are corrected together; the output matches three decode() calls on the
+/// 9 byte frames of the burst. Only valid in the DECODE_DMR_AMBE mode.
+/// </remarks>
+/// <param name="burst">33 bytes of DMR voice burst.</param>
+/// <param name="samples">480 PCM samples.</param>
+/// <param name="stats">Error counts for the burst; may be null.</param>
+/// <returns>Total corrected bit errors of the burst, or -1 if the decoder is not in DMR mode.</returns>
+int32_t MBEDecoder::decodeDMRBurst(const uint8_t* burst, int16_t samples[], DMRBurstStats* stats)
+{
+    if (m_mbeMode != DECODE_DMR_AMBE)
+        return -1;
 
-        if (gainMaxIdx > 24) {
-            gainMaxIdx = 0;
-            gainMaxBufPtr = gainMaxBuf;
-        }
+    uint32_t a[3U], b[3U], c[3U];
+    AMBEFEC::getDMRFrames(burst, a, b, c);
+
+    char ambe_d[3U][49U];
+    int errs[3U], errs2[3U];
+    decodeAMBE(a, b, c, ambe_d, errs, errs2, 3U);
+
+    int32_t totalErrs = 0;
+    for (uint32_t i = 0U; i < 3U; i++) {
+        char ambeErrStr[64U];
+        ::memset(ambeErrStr, 0x20U, 64U);
+
+        float samplesF[160U];
+        mbe_processAmbe2450DataF(samplesF, &errs[i], &errs2[i], ambeErrStr, ambe_d[i], m_mbelibParms->m_cur_mp, m_mbelibParms->m_prev_mp, m_mbelibParms->m_prev_mp_enhanced, 3);
+
+        gainSamples(samplesF, samples + (i * 160U));
+
+        if (stats != nullptr)
+            stats->m_errs[i] = errs2[i];
+        totalErrs += errs2[i];
+    }
+
+    if (stats != nullptr)
+        stats->m_totalErrs = totalErrs;
+
+    return totalErrs;
+}
+
+/// <summary>
+/// Returns the number of PCM samples at the stream sample rate decoded from each codeword.
+/// </summary>
+/// <remarks>Each codeword is 20ms of audio, which is a whole number of samples at every supported rate.</remarks>
+/// <returns></returns>
+uint32_t MBEDecoder::getStreamSamples() const
+{
+    return m_sampleRate / 50U;
+}
+
+/// <summary>
+/// Decodes the given MBE codewords to PCM samples at the stream sample rate.
+/// </summary>
+/// <param name="codeword"></param>
+/// <param name="samples">getStreamSamples() PCM samples.</param>
+/// <returns>Corrected bit errors, or -1 if the stream sample rate is not supported.</returns>
+int32_t MBEDecoder::decodeStream(uint8_t* codeword, int16_t samples[])
+{
+    if (!Resampler::isSupportedRate(m_sampleRate))
+        return -1;
+
+    if (m_resampler == nullptr)
+        return decode(codeword, samples);
+
+    int16_t frame[160U];
+    ::memset(frame, 0x00U, sizeof(frame));
+    int32_t errs = decode(codeword, frame);
+
+    m_resampler->process(frame, 160U, samples);
+    return errs;
+}
+
+/// <summary>
+/// Decodes the given MBE codewords to float PCM samples at the stream sample rate.
+/// </summary>
+/// <remarks>The decoded frame stays in float through the output gain and the resampler.</remarks>
+/// <param name="codeword"></param>
+/// <param name="samples">getStreamSamples() PCM samples, scaled to +/-1.0.</param>
+/// <returns>Corrected bit errors, or -1 if the stream sample rate is not supported.</returns>
+int32_t MBEDecoder::decodeStreamF(uint8_t* codeword, float samples[])
+{
+    if (!Resampler::isSupportedRate(m_sampleRate))
+        return -1;
+
+    float samplesF[160U];
+    ::memset(samplesF, 0x00U, sizeof(samplesF));
+    int32_t errs = decodeF(codeword, samplesF);
+
+    if (m_resampler == nullptr) {
+        gainSamplesF(samplesF, samples);
+        return errs;
+    }
+
+    float frame[160U];
+    gainSamplesF(samplesF, frame);
+    m_resampler->process(frame, 160U, samples);
+    return errs;
+}
 
-        // lookup max history
-        for (int i = 0; i < 25; i++) {
-            float a = gainMaxBuf[i];
-            if (a > max) {
-                max = a;
+/// <summary>
+/// Discards resampler history.
+/// </summary>
+void MBEDecoder::resetStream()
+{
+    if (m_resampler != nullptr)
+        m_resampler->reset();
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/// <summary>
+/// Corrects a run of AMBE frames from their a, b and c words and builds their 49-bit parameter vectors.
+/// </summary>
+/// <remarks>
+/// The error counts match mbe_eccAmbe3600x2450C0() and mbe_eccAmbe3600x2450Data(), which only
+/// count errors in the data bits of the C0 and C1 Golay words.
+/// </remarks>
+/// <param name="a">24-bit a words.</param>
+/// <param name="b">23-bit b words.</param>
+/// <param name="c">25-bit c words.</param>
+/// <param name="ambe_d">49-bit parameter vector of each frame.</param>
+/// <param name="errs">C0 bit errors of each frame.</param>
+/// <param name="errs2">C0 and C1 bit errors of each frame.</param>
+/// <param name="count">Number of frames.</param>
+void MBEDecoder::decodeAMBE(const uint32_t* a, const uint32_t* b, const uint32_t* c, char (*ambe_d)[49U], int* errs, int* errs2, uint32_t count)
+{
+    uint32_t c0data[3U], c1data[3U];
+    for (uint32_t offset = 0U; offset < count; offset += 3U) {
+        uint32_t n = (count - offset) < 3U ? (count - offset) : 3U;
+
+        AMBEFEC::decodeAMBE(a + offset, b + offset, c0data, c1data, n);
+
+        for (uint32_t i = 0U; i < n; i++) {
+            uint32_t k = offset + i;
+
+            // C1 is compared after demodulation, as mbelib does
+            uint32_t c1 = b[k] ^ (PRNG_TABLE[c0data[i]] >> 1);
+            errs[k] = (int)Utils::countBits32(c0data[i] ^ (a[k] >> 12));
+            errs2[k] = errs[k] + (int)Utils::countBits32(c1data[i] ^ (c1 >> 11));
+
+            for (uint32_t j = 0U; j < 12U; j++) {
+                ambe_d[k][j] = (char)((c0data[i] >> (11U - j)) & 0x01U);
+                ambe_d[k][12U + j] = (char)((c1data[i] >> (11U - j)) & 0x01U);
             }
+            for (uint32_t j = 0U; j < 25U; j++)
+                ambe_d[k][24U + j] = (char)((c[k] >> (24U - j)) & 0x01U);
         }
+    }
+}
+
+/// <summary>
+/// Adds a frame peak to the AGC history and returns the peak of the history window.
+/// </summary>
+/// <remarks>
+/// The history holds only the peaks that can still become the window maximum, in decreasing
+/// order, so each frame costs O(1) amortized instead of a rescan of the whole window. Peaks are
+/// never negative, so an empty history slot behaves like the zeroed history of a new decoder.
+/// </remarks>
+/// <param name="max">Peak level of the current frame.</param>
+/// <returns>Peak level of the last GAIN_HISTORY_LENGTH frames.</returns>
+float MBEDecoder::gainMaxHistory(float max)
+{
+    // drop peaks that have left the window
+    while (m_gainMaxCount > 0U && (m_gainFrame - m_gainMaxFrame[m_gainMaxHead]) >= GAIN_HISTORY_LENGTH) {
+        m_gainMaxHead = (m_gainMaxHead + 1U) % GAIN_HISTORY_LENGTH;
+        m_gainMaxCount--;
+    }
+
+    // drop peaks that can no longer be the maximum
+    while (m_gainMaxCount > 0U && m_gainMax[(m_gainMaxHead + m_gainMaxCount - 1U) % GAIN_HISTORY_LENGTH] <= max) {
+        m_gainMaxCount--;
+    }
+
+    uint32_t tail = (m_gainMaxHead + m_gainMaxCount) % GAIN_HISTORY_LENGTH;
+    m_gainMax[tail] = max;
+    m_gainMaxFrame[tail] = m_gainFrame;
+    m_gainMaxCount++;
+    m_gainFrame++;
+
+    return m_gainMax[m_gainMaxHead];
+}
+
+/// <summary>
+/// Determines the output gain of decoded PCM samples, updating the AGC state.
+/// </summary>
+/// <param name="samplesF">160 decoded PCM samples.</param>
+/// <param name="gainDelta">Gain step per sample.</param>
+/// <returns>Gain of the first sample.</returns>
+float MBEDecoder::outputGain(const float samplesF[], float& gainDelta)
+{
+    float gain = m_gainAdjust;
+    gainDelta = 0.0f;
+    if (m_autoGain) {
+        // detect max level, and lookup max history
+        float max = gainMaxHistory(peakLevel(samplesF, m_vectorOutput));
 
         // determine optimal gain level
-        float gainFactor = 0.0f, gainDelta = 0.0f;
+        float gainFactor = 0.0f;
         if (max > static_cast<float>(0)) {
             gainFactor = (static_cast<float>(30000) / max);
         }
@@ -298,36 +651,36 @@ int32_t MBEDecoder::decode(uint8_t* codeword, int16_t samples[])
         gainDelta /= static_cast<float>(160);
 
         // adjust output gain
-        sampleFPtr = samplesF;
-        for (int n = 0; n < 160; n++) {
-            *sampleFPtr = (m_gainAdjust + (static_cast<float>(n) * gainDelta)) * (*sampleFPtr);
-            sampleFPtr++;
-        }
-
+        gain = m_gainAdjust;
         m_gainAdjust += (static_cast<float>(160) * gainDelta);
     }
 
-    int16_t* samplePtr = samples;
-    sampleFPtr = samplesF;
-    for (int n = 0; n < 160; n++) {
-        float smp = *sampleFPtr;
-        if (!m_autoGain) {
-            smp *= m_gainAdjust;
-        }
+    return gain;
+}
 
-        // audio clipping
-        if (smp > 32760) {
-            smp = 32760;
-        }
-        else if (smp < -32760) {
-            smp = -32760;
-        }
+/// <summary>
+/// Applies the output gain to decoded PCM samples and clips them to 16-bit.
+/// </summary>
+/// <param name="samplesF">160 decoded PCM samples.</param>
+/// <param name="samples">160 PCM samples.</param>
+void MBEDecoder::gainSamples(const float samplesF[], int16_t samples[])
+{
+    float gainDelta = 0.0f;
+    float gain = outputGain(samplesF, gainDelta);
 
-        *samplePtr = (int16_t)(smp);
-        
-        samplePtr++;
-        sampleFPtr++;
-    }
+    // with a zero gain delta the ramp is a plain multiply by the gain
+    outputSamples(samplesF, gain, gainDelta, samples, m_vectorOutput);
+}
 
-    return errs;
+/// <summary>
+/// Applies the output gain to decoded PCM samples and scales them to +/-1.0.
+/// </summary>
+/// <param name="samplesF">160 decoded PCM samples.</param>
+/// <param name="samples">160 float PCM samples.</param>
+void MBEDecoder::gainSamplesF(const float samplesF[], float samples[])
+{
+    float gainDelta = 0.0f;
+    float gain = outputGain(samplesF, gainDelta);
+
+    outputSamplesF(samplesF, gain, gainDelta, samples);
 }
@@ -19,6 +19,7 @@ extern "C" {
 }
 
 #include "Defines.h"
+#include "Resampler.h"
 
 #include <stdlib.h>
 #include <queue>
@@ -39,18 +40,26 @@ namespace vocoder
         /// <summary></summary>
         mbelibParms()
         {
-            m_cur_mp = (mbe_parms*)malloc(sizeof(mbe_parms));
-            m_prev_mp = (mbe_parms*)malloc(sizeof(mbe_parms));
-            m_prev_mp_enhanced = (mbe_parms*)malloc(sizeof(mbe_parms));
+            // the three parameter sets share one allocation, each starting on a cache line
+            m_block = malloc((3U * PARMS_STRIDE) + PARMS_ALIGN);
+            uint8_t* base = (uint8_t*)(((uintptr_t)m_block + (PARMS_ALIGN - 1U)) & ~(uintptr_t)(PARMS_ALIGN - 1U));
+
+            m_cur_mp = (mbe_parms*)base;
+            m_prev_mp = (mbe_parms*)(base + PARMS_STRIDE);
+            m_prev_mp_enhanced = (mbe_parms*)(base + (2U * PARMS_STRIDE));
         }
 
         /// <summary></summary>
         ~mbelibParms()
         {
-            free(m_prev_mp_enhanced);
-            free(m_prev_mp);
-            free(m_cur_mp);
+            free(m_block);
         }
+
+    private:
+        static const size_t PARMS_ALIGN = 64U;
+        static const size_t PARMS_STRIDE = (sizeof(mbe_parms) + PARMS_ALIGN - 1U) & ~(PARMS_ALIGN - 1U);
+
+        void* m_block;
     };
 
     // ---------------------------------------------------------------------------
@@ -59,7 +68,21 @@ namespace vocoder
 
     enum MBE_DECODER_MODE {
         DECODE_DMR_AMBE,
-        DECODE_88BIT_IMBE   // e.g. IMBE used by P25
+        DECODE_88BIT_IMBE,  // e.g. IMBE used by P25
+        DECODE_NXDN_AMBE
+    };
+
+    // ---------------------------------------------------------------------------
+    //  Structure Declaration
+    //      Error counts for a decoded DMR voice burst.
+    // ---------------------------------------------------------------------------
+
+    struct DMRBurstStats
+    {
+        /// <summary>Corrected C0/C1 bit errors of each AMBE frame, as returned by decode().</summary>
+        int32_t m_errs[3U];
+        /// <summary>Total corrected bit errors of the burst.</summary>
+        int32_t m_totalErrs;
     };
 
     // ---------------------------------------------------------------------------
@@ -71,7 +94,7 @@ namespace vocoder
     {
     public:
         /// <summary>Initializes a new instance of the MBEDecoder class.</summary>
-        MBEDecoder(MBE_DECODER_MODE mode);
+        MBEDecoder(MBE_DECODER_MODE mode, uint32_t sampleRate = MBE_SAMPLE_RATE);
         /// <summary>Finalizes a instance of the MBEDecoder class.</summary>
         ~MBEDecoder();
 
@@ -83,11 +106,26 @@ namespace vocoder
         /// <summary>Decodes the given MBE codewords to PCM samples using the decoder mode.</summary>
         int32_t decode(uint8_t* codeword, int16_t samples[]);
 
+        /// <summary>Decodes the three AMBE frames of a DMR voice burst to PCM samples.</summary>
+        int32_t decodeDMRBurst(const uint8_t* burst, int16_t samples[], DMRBurstStats* stats = nullptr);
+
+        /// <summary>Returns the number of PCM samples at the stream sample rate decoded from each codeword.</summary>
+        uint32_t getStreamSamples() const;
+
+        /// <summary>Decodes the given MBE codewords to PCM samples at the stream sample rate.</summary>
+        int32_t decodeStream(uint8_t* codeword, int16_t samples[]);
+        /// <summary>Decodes the given MBE codewords to float PCM samples at the stream sample rate.</summary>
+        int32_t decodeStreamF(uint8_t* codeword, float samples[]);
+        /// <summary>Discards resampler history.</summary>
+        void resetStream();
+
     private:
         mbelibParms* m_mbelibParms;
 
         MBE_DECODER_MODE m_mbeMode;
 
+        Resampler* m_resampler;
+
         static const int dW[72];
         static const int dX[72];
         static const int rW[36];
@@ -95,15 +133,36 @@ namespace vocoder
         static const int rY[36];
         static const int rZ[36];
 
-        float gainMaxBuf[200];
-        float* gainMaxBufPtr;
-        int gainMaxIdx;
+        static const uint32_t GAIN_HISTORY_LENGTH = 25U;
+
+        // frame peaks of the AGC history window, decreasing from m_gainMaxHead
+        float m_gainMax[GAIN_HISTORY_LENGTH];
+        uint32_t m_gainMaxFrame[GAIN_HISTORY_LENGTH];
+        uint32_t m_gainMaxHead;
+        uint32_t m_gainMaxCount;
+        uint32_t m_gainFrame;
+
+        /// <summary>Adds a frame peak to the AGC history and returns the peak of the history window.</summary>
+        float gainMaxHistory(float max);
+
+        /// <summary>Corrects a run of AMBE frames from their a, b and c words and builds their 49-bit parameter vectors.</summary>
+        static void decodeAMBE(const uint32_t* a, const uint32_t* b, const uint32_t* c, char (*ambe_d)[49U], int* errs, int* errs2, uint32_t count);
+        /// <summary>Determines the output gain of decoded PCM samples, updating the AGC state.</summary>
+        float outputGain(const float samplesF[], float& gainDelta);
+        /// <summary>Applies the output gain to decoded PCM samples and clips them to 16-bit.</summary>
+        void gainSamples(const float samplesF[], int16_t samples[]);
+        /// <summary>Applies the output gain to decoded PCM samples and scales them to +/-1.0.</summary>
+        void gainSamplesF(const float samplesF[], float samples[]);
 
     public:
         /// <summary></summary>
         __PROPERTY(float, gainAdjust, GainAdjust);
         /// <summary></summary>
         __PROPERTY(bool, autoGain, AutoGain);
+        /// <summary>Flag indicating the decoder uses the SIMD output stage, where supported.</summary>
+        __PROPERTY(bool, vectorOutput, VectorOutput);
+        /// <summary>Sample rate of PCM samples produced by the stream decoder.</summary>
+        __READONLY_PROPERTY(uint32_t, sampleRate, SampleRate);
     };
 } // namespace vocoder
 
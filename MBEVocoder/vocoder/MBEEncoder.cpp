@@ -13,6 +13,7 @@
 */
 #define _USE_MATH_DEFINES
 #include <math.h>
+#include <cassert>
 
 /*
  * AMBE halfrate encoder - Copyright 2016 Max H. Parke KA1RBI
@@ -37,11 +38,17 @@
  */
 
 #include "Defines.h"
+#include "PCMOps.h"
 #include "edac/AMBEFEC.h"
 #include "edac/Golay24128.h"
 #include "vocoder/MBEEncoder.h"
+#include "vocoder/mbe_math.h"
 #include "vocoder/ambe3600x2450_const.h"
-#include "vocoder/ambe3600x2400_const.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define VQ_SEARCH_SSE2
+#endif
 
 using namespace edac;
 using namespace vocoder;
@@ -161,81 +168,420 @@ static const short b0_lookup[] = {
     119, 119, 119
 };
 
+// AMBE block DCT lengths (AmbeLmprbl) never exceed this
+#define AMBE_DCT_MAX_J 17
+// number of leading DCT coefficients consumed by the PRBA and HOC quantizers
+#define AMBE_DCT_NUM_COEFFS 6
+// sum of J * min(J, AMBE_DCT_NUM_COEFFS) for J = 1 .. AMBE_DCT_MAX_J
+#define AMBE_DCT_BASIS_LEN 883
+
+// cosine basis rows for each block length J, packed back-to-back starting at ambeDctBasisOffset[J]
+static float ambeDctBasis[AMBE_DCT_BASIS_LEN];
+static int ambeDctBasisOffset[AMBE_DCT_MAX_J + 1];
+// cosine basis for the 8-point PRBA DCT
+static float ambePrbaBasis[8][8];
+
+// number of quantized fundamental frequencies (b0) in the AMBE W0/L tables
+#define AMBE_NUM_B0 120
+// number of V/UV codebook patterns searched for b1
+#define AMBE_NUM_VUV 17
+
+// final b0 for each starting b0 and harmonic count (num_harms - NUM_HARMS_MIN), or -1 if none matches
+static signed char ambeB0Tbl[AMBE_NUM_B0][NUM_HARMS_MAX - NUM_HARMS_MIN + 1];
+// V/UV codebook band (jl) of each harmonic for each b0
+static uint8_t ambeVuvBandTbl[AMBE_NUM_B0][NUM_HARMS_MAX];
+// bit n set when V/UV codebook pattern n marks the band as voiced
+static uint32_t ambeVuvBandMask[8];
+
+// structure-of-arrays copies of the AMBE codebooks; row d holds dimension d of every entry
+static float ambePRBA24SoA[3][512];
+static float ambePRBA58SoA[4][128];
+static float ambeHOCb5SoA[4][32];
+static float ambeHOCb6SoA[4][16];
+static float ambeHOCb7SoA[4][16];
+static float ambeHOCb8SoA[4][8];
+
 // ---------------------------------------------------------------------------
 //  Global Functions
 // ---------------------------------------------------------------------------
 
+/// <summary>
+/// Builds the cosine basis tables used by the AMBE encoder block and PRBA DCTs.
+/// </summary>
+/// <remarks>Entries are evaluated with the same single-precision cosine expression as the
+/// reference DCT definition, so the coefficients are bit-identical.</remarks>
+/// <returns>True, once the tables are built.</returns>
+static bool buildAmbeDctBasis()
+{
+    int offset = 0;
+    for (int J = 1; J <= AMBE_DCT_MAX_J; J++) {
+        ambeDctBasisOffset[J] = offset;
+        for (int k = 1; k <= J && k <= AMBE_DCT_NUM_COEFFS; k++) {
+            for (int j = 1; j <= J; j++) {
+                ambeDctBasis[offset++] = cosf((M_PI * (((float)k) - 1.0) * (((float)j) - 0.5)) / (float)J);
+            }
+        }
+    }
+
+    for (int m = 1; m <= 8; m++) {
+        for (int i = 1; i <= 8; i++) {
+            ambePrbaBasis[m - 1][i - 1] = cosf((M_PI * (((float)m) - 1.0) * (((float)i) - 0.5)) / 8.0);
+        }
+    }
+
+    return true;
+}
+
+/// <summary>
+/// Builds the b0 and V/UV band lookup tables used by the AMBE encoder.
+/// </summary>
+/// <returns>True, once the tables are built.</returns>
+static bool buildAmbeB0Tables()
+{
+    // a b0_lookup estimate is moved one step at a time toward the b0 whose harmonic count matches,
+    // so the final b0 depends only on the starting b0 and the harmonic count
+    for (int start = 0; start < AMBE_NUM_B0; start++) {
+        for (int numHarms = NUM_HARMS_MIN; numHarms <= NUM_HARMS_MAX; numHarms++) {
+            int b0 = start;
+            int dir = 0;
+            while (b0 >= 0 && b0 < AMBE_NUM_B0 && (int)AmbeLtable[b0] != numHarms) {
+                int step = ((int)AmbeLtable[b0] < numHarms) ? 1 : -1;
+                if (dir != 0 && step != dir) {
+                    b0 = -1;
+                    break;
+                }
+
+                dir = step;
+                b0 += step;
+            }
+
+            ambeB0Tbl[start][numHarms - NUM_HARMS_MIN] = (b0 >= 0 && b0 < AMBE_NUM_B0) ? b0 : -1;
+        }
+    }
+
+    for (int b0 = 0; b0 < AMBE_NUM_B0; b0++) {
+        for (int l = 1; l <= NUM_HARMS_MAX; l++) {
+            int jl = (int)((float)l * (float)16.0 * AmbeW0table[b0]);
+            ambeVuvBandTbl[b0][l - 1] = (jl > 7) ? 7 : jl;
+        }
+    }
+
+    for (int jl = 0; jl < 8; jl++) {
+        ambeVuvBandMask[jl] = 0U;
+        for (int n = 0; n < AMBE_NUM_VUV; n++) {
+            if (AmbeVuv[n][jl])
+                ambeVuvBandMask[jl] |= 1U << n;
+        }
+    }
+
+    return true;
+}
+
+/// <summary>
+/// Builds the structure-of-arrays copies of the AMBE PRBA and HOC codebooks.
+/// </summary>
+/// <returns>True, once the tables are built.</returns>
+static bool buildAmbeCodebooks()
+{
+    for (int d = 0; d < 3; d++) {
+        for (int n = 0; n < 512; n++)
+            ambePRBA24SoA[d][n] = AmbePRBA24[n][d];
+    }
+
+    for (int d = 0; d < 4; d++) {
+        for (int n = 0; n < 128; n++)
+            ambePRBA58SoA[d][n] = AmbePRBA58[n][d];
+        for (int n = 0; n < 32; n++)
+            ambeHOCb5SoA[d][n] = AmbeHOCb5[n][d];
+        for (int n = 0; n < 16; n++) {
+            ambeHOCb6SoA[d][n] = AmbeHOCb6[n][d];
+            ambeHOCb7SoA[d][n] = AmbeHOCb7[n][d];
+        }
+        for (int n = 0; n < 8; n++)
+            ambeHOCb8SoA[d][n] = AmbeHOCb8[n][d];
+    }
+
+    return true;
+}
+
+/// <summary>
+/// Finds the codebook entry with the smallest squared euclidean distance to the given vector.
+/// </summary>
+/// <remarks>With SSE2 four codebook entries are scored per pass over the structure-of-arrays rows, each
+/// lane tracking its own best match; otherwise entries are scored one at a time. In both cases an entry
+/// is abandoned as soon as its partial distance reaches the best distance so far. Distances are
+/// accumulated in the same order as an exhaustive search and ties resolve to the lowest index, so the
+/// chosen index is identical to the exhaustive search.</remarks>
+/// <param name="x">Vector to quantize.</param>
+/// <param name="cb">Structure-of-arrays codebook.</param>
+/// <param name="stride">Distance between dimension rows in the codebook.</param>
+/// <param name="size">Number of codebook entries (a multiple of 4).</param>
+/// <param name="dim">Number of dimensions to compare.</param>
+/// <returns>Index of the nearest codebook entry.</returns>
+static int vqSearch(const float* x, const float* cb, int stride, int size, int dim)
+{
+#if defined(VQ_SEARCH_SSE2)
+    __m128i idx = _mm_setr_epi32(0, 1, 2, 3);
+    const __m128i four = _mm_set1_epi32(4);
+
+    // the first four entries seed the per-lane best matches
+    __m128 bestErr = _mm_setzero_ps();
+    for (int d = 0; d < dim; d++) {
+        __m128 diff = _mm_sub_ps(_mm_set1_ps(x[d]), _mm_loadu_ps(cb + (d * stride)));
+        bestErr = _mm_add_ps(bestErr, _mm_mul_ps(diff, diff));
+    }
+    __m128i bestIdx = idx;
+
+    for (int n = 4; n < size; n += 4) {
+        idx = _mm_add_epi32(idx, four);
+
+        __m128 err = _mm_setzero_ps();
+        __m128 lt = _mm_setzero_ps();
+        for (int d = 0; d < dim; d++) {
+            __m128 diff = _mm_sub_ps(_mm_set1_ps(x[d]), _mm_loadu_ps(cb + (d * stride) + n));
+            err = _mm_add_ps(err, _mm_mul_ps(diff, diff));
+            lt = _mm_cmplt_ps(err, bestErr);
+            if (_mm_movemask_ps(lt) == 0)
+                break;
+        }
+
+        bestErr = _mm_or_ps(_mm_and_ps(lt, err), _mm_andnot_ps(lt, bestErr));
+        __m128i ltMask = _mm_castps_si128(lt);
+        bestIdx = _mm_or_si128(_mm_and_si128(ltMask, idx), _mm_andnot_si128(ltMask, bestIdx));
+    }
+
+    float laneErr[4];
+    int laneIdx[4];
+    _mm_storeu_ps(laneErr, bestErr);
+    _mm_storeu_si128((__m128i*)laneIdx, bestIdx);
+
+    float error = laneErr[0];
+    int errorIndex = laneIdx[0];
+    for (int l = 1; l < 4; l++) {
+        if (laneErr[l] < error || (laneErr[l] == error && laneIdx[l] < errorIndex)) {
+            error = laneErr[l];
+            errorIndex = laneIdx[l];
+        }
+    }
+
+    return errorIndex;
+#else
+    float error = 0.0;
+    int errorIndex = 0;
+
+    for (int n = 0; n < size; n++) {
+        float err = 0.0;
+        for (int d = 0; d < dim && (n == 0 || err < error); d++) {
+            float diff = x[d] - cb[(d * stride) + n];
+            err += (diff * diff);
+        }
+
+        if (n == 0 || err < error) {
+            error = err;
+            errorIndex = n;
+        }
+    }
+
+    return errorIndex;
+#endif
+}
+
+/// <summary>
+/// Updates the encoder prediction state from the quantized parameters of the current frame.
+/// </summary>
+/// <remarks>This follows mbe_dequantizeAmbe2250Parms and mbe_moveMbeParms, but only derives the
+/// fields the next frame's prediction reads (L, gamma and log2Ml); w0, V/UV, Ml and the phase
+/// state are never needed by the encoder. log2Ml entries above L keep their previous values, as
+/// they would after the full parameter move.</remarks>
+/// <param name="prev_mp">Previous frame parameters, replaced with the current frame's state.</param>
+/// <param name="b">Quantized AMBE parameters of the current frame.</param>
+static void updateAMBEState(mbe_parms* prev_mp, const int b[])
+{
+#if defined(_DEBUG)
+    // debug builds run the full dequantizer alongside, to check the derived state matches it
+    mbe_parms refPrev = *prev_mp;
+    mbe_parms refCur;
+    mbe_dequantizeAmbe2250Parms(&refCur, &refPrev, b);
+#endif
+
+    int L = (int)AmbeLtable[b[0]];
+    float gamma = AmbeDg[b[2]] + ((float)0.5 * prev_mp->gamma);
+
+    // decode PRBA vectors
+    float Gm[8];
+    Gm[0] = 0;
+    Gm[1] = AmbePRBA24[b[3]][0];
+    Gm[2] = AmbePRBA24[b[3]][1];
+    Gm[3] = AmbePRBA24[b[3]][2];
+    Gm[4] = AmbePRBA58[b[4]][0];
+    Gm[5] = AmbePRBA58[b[4]][1];
+    Gm[6] = AmbePRBA58[b[4]][2];
+    Gm[7] = AmbePRBA58[b[4]][3];
+
+    float Ri[8];
+    for (int i = 0; i < 8; i++) {
+        float sum = 0;
+        for (int m = 0; m < 8; m++) {
+            float am = (m == 0) ? 1.0f : 2.0f;
+            sum = sum + (am * Gm[m] * ambePrbaBasis[m][i]);
+        }
+        Ri[i] = sum;
+    }
+
+    // first two elements of each Ci,k block from the PRBA vector, the rest from the HOC tables
+    float rconst = ((float)1 / ((float)2 * M_SQRT2));
+    float Cik[4][AMBE_DCT_NUM_COEFFS];
+    for (int i = 0; i < 4; i++) {
+        Cik[i][0] = (float)0.5 * (Ri[2 * i] + Ri[(2 * i) + 1]);
+        Cik[i][1] = rconst * (Ri[2 * i] - Ri[(2 * i) + 1]);
+    }
+
+    const int8_t* Ji = AmbeLmprbl[L];
+    for (int k = 2; k < AMBE_DCT_NUM_COEFFS; k++) {
+        Cik[0][k] = AmbeHOCb5[b[5]][k - 2];
+        Cik[1][k] = AmbeHOCb6[b[6]][k - 2];
+        Cik[2][k] = AmbeHOCb7[b[7]][k - 2];
+        Cik[3][k] = AmbeHOCb8[b[8]][k - 2];
+    }
+
+    // inverse DCT each Ci,k to give ci,j (Tl); coefficients above k = 6 are zero
+    float Tl[NUM_HARMS_MAX + 1];
+    int l = 1;
+    for (int i = 0; i < 4; i++) {
+        int ji = Ji[i];
+        int kMax = (ji < AMBE_DCT_NUM_COEFFS) ? ji : AMBE_DCT_NUM_COEFFS;
+        const float* basis = &ambeDctBasis[ambeDctBasisOffset[ji]];
+        for (int j = 0; j < ji; j++) {
+            float sum = 0;
+            for (int k = 0; k < kMax; k++) {
+                float ak = (k == 0) ? 1.0f : 2.0f;
+                sum = sum + (ak * Cik[i][k] * basis[(k * ji) + j]);
+            }
+            Tl[l++] = sum;
+        }
+    }
+
+    // fix for when L > L(-1)
+    if (L > prev_mp->L) {
+        for (l = (prev_mp->L) + 1; l <= L; l++)
+            prev_mp->log2Ml[l] = prev_mp->log2Ml[prev_mp->L];
+    }
+    prev_mp->log2Ml[0] = prev_mp->log2Ml[1];
+
+    float deltal[NUM_HARMS_MAX + 1];
+    int intkl[NUM_HARMS_MAX + 1];
+    float Sum43 = 0;
+    for (l = 1; l <= L; l++) {
+        float flokl = ((float)prev_mp->L / (float)L) * (float)l;
+        intkl[l] = (int)flokl;
+        deltal[l] = flokl - (float)intkl[l];
+        Sum43 = Sum43 + ((((float)1 - deltal[l]) * prev_mp->log2Ml[intkl[l]]) + (deltal[l] * prev_mp->log2Ml[intkl[l] + 1]));
+    }
+    Sum43 = (((float)0.65 / (float)L) * Sum43);
+
+    float Sum42 = 0;
+    for (l = 1; l <= L; l++)
+        Sum42 += Tl[l];
+    Sum42 = Sum42 / (float)L;
+
+    float BigGamma = gamma - ((float)0.5 * (log((double)L) / log(2.0))) - Sum42;
+
+    // the new log2Ml values are built aside, as the prediction reads the previous values
+    float log2Ml[NUM_HARMS_MAX + 1];
+    for (l = 1; l <= L; l++) {
+        float c1 = ((float)0.65 * ((float)1 - deltal[l]) * prev_mp->log2Ml[intkl[l]]);
+        float c2 = ((float)0.65 * deltal[l] * prev_mp->log2Ml[intkl[l] + 1]);
+        log2Ml[l] = Tl[l] + c1 + c2 - Sum43 + BigGamma;
+    }
+
+    prev_mp->L = L;
+    prev_mp->gamma = gamma;
+    prev_mp->log2Ml[0] = 0;
+    for (l = 1; l <= L; l++)
+        prev_mp->log2Ml[l] = log2Ml[l];
+
+#if defined(_DEBUG)
+    assert(prev_mp->L == refCur.L);
+    assert(prev_mp->gamma == refCur.gamma);
+    for (l = 1; l <= L; l++)
+        assert(prev_mp->log2Ml[l] == refCur.log2Ml[l]);
+#endif
+}
+
 /// <summary>
 /// 
 /// </summary>
 /// <param name="imbe_param"></param>
 /// <param name="b"></param>
-/// <param name="cur_mp"></param>
 /// <param name="prev_mp"></param>
 /// <param name="gainAdjust"></param>
-static void encodeAMBE(const IMBE_PARAM* imbe_param, int b[], mbe_parms* cur_mp, mbe_parms* prev_mp, float gainAdjust)
+static void encodeAMBE(const IMBE_PARAM* imbe_param, int b[], mbe_parms* prev_mp, float gainAdjust)
 {
     static const float SQRT_2 = sqrtf(2.0);
+    static const bool dctBasisBuilt = buildAmbeDctBasis();
+    static const bool codebooksBuilt = buildAmbeCodebooks();
+    static const bool b0TablesBuilt = buildAmbeB0Tables();
+    (void)dctBasisBuilt;
+    (void)codebooksBuilt;
+    (void)b0TablesBuilt;
     static const int b0_lmax = sizeof(b0_lookup) / sizeof(b0_lookup[0]);
     // int b[9];
 
     // ref_pitch is Q8_8 in range 19.875 - 123.125
     int b0_i = (imbe_param->ref_pitch >> 5) - 159;
-    if (b0_i < 0 || b0_i > b0_lmax) {
+    if (b0_i < 0 || b0_i >= b0_lmax) {
         fprintf(stderr, "encode error b0_i %d\n", b0_i);
         return;
     }
 
-    b[0] = b0_lookup[b0_i];
-    int L = (int)AmbeLtable[b[0]];
-
     // adjust b0 until L agrees
-    while (L != imbe_param->num_harms) {
-        if (L < imbe_param->num_harms)
-            b0_i++;
-        else if (L > imbe_param->num_harms)
-            b0_i--;
-        if (b0_i < 0 || b0_i > b0_lmax) {
-            fprintf(stderr, "encode error2 b0_i %d\n", b0_i);
-            return;
-        }
-        b[0] = b0_lookup[b0_i];
-        L = (int)AmbeLtable[b[0]];
+    int b0 = -1;
+    if (imbe_param->num_harms >= NUM_HARMS_MIN && imbe_param->num_harms <= NUM_HARMS_MAX)
+        b0 = ambeB0Tbl[b0_lookup[b0_i]][imbe_param->num_harms - NUM_HARMS_MIN];
+    if (b0 < 0) {
+        fprintf(stderr, "encode error2 b0_i %d\n", b0_i);
+        return;
     }
 
-    float m_float2[NUM_HARMS_MAX];
+    b[0] = b0;
+    int L = (int)AmbeLtable[b[0]];
+
+    // V/UV decision; the energy of every harmonic whose decision disagrees with a codebook
+    // pattern is accumulated for all patterns at once, in harmonic order
+    float En[AMBE_NUM_VUV];
+    for (int n = 0; n < AMBE_NUM_VUV; n++)
+        En[n] = 0.0;
+
+    const uint8_t* bands = ambeVuvBandTbl[b[0]];
     for (int l = 1; l <= L; l++) {
-        m_float2[l - 1] = (float)imbe_param->sa[l - 1];
-        m_float2[l - 1] = m_float2[l - 1] * m_float2[l - 1];
+        int kl = 12;
+        if (l <= 36)
+            kl = (l + 2) / 3;
+
+        float m2 = (float)imbe_param->sa[l - 1];
+        m2 = m2 * m2;
+
+        uint32_t mismatch = ambeVuvBandMask[bands[l - 1]];
+        if (imbe_param->v_uv_dsn[(kl - 1) * 3])
+            mismatch = ~mismatch;
+
+        for (int n = 0; n < AMBE_NUM_VUV; n++)
+            En[n] += ((mismatch >> n) & 1U) ? m2 : 0.0f;
     }
 
-    float en_min = 0;
+    float en_min = En[0];
     b[1] = 0;
-    int vuv_max = 17;
-    for (int n = 0; n < vuv_max; n++) {
-        float En = 0;
-        for (int l = 1; l <= L; l++) {
-            int jl = (int)((float)l * (float)16.0 * AmbeW0table[b[0]]);
-            int kl = 12;
-            if (l <= 36)
-                kl = (l + 2) / 3;
-
-            if (imbe_param->v_uv_dsn[(kl - 1) * 3] != AmbeVuv[n][jl])
-                En += m_float2[l - 1];
-        }
-
-        if (n == 0)
-            en_min = En;
-        else if (En < en_min) {
+    for (int n = 1; n < AMBE_NUM_VUV; n++) {
+        if (En[n] < en_min) {
             b[1] = n;
-            en_min = En;
+            en_min = En[n];
         }
     }
 
     // log spectral amplitudes
     float num_harms_f = (float)imbe_param->num_harms;
-    float log_l_2 = 0.5 * log2f(num_harms_f);	// fixme: table lookup
-    float log_l_w0 = 0.5 * log2f(num_harms_f * AmbeW0table[b[0]] * 2.0 * M_PI) + 2.289;
+    float log_l_2 = 0.5 * mbe_log2f(num_harms_f);	// fixme: table lookup
+    float log_l_w0 = 0.5 * mbe_log2f(num_harms_f * AmbeW0table[b[0]] * 2.0 * M_PI) + 2.289;
     float lsa[NUM_HARMS_MAX];
     float lsa_sum = 0.0;
 
@@ -243,9 +589,9 @@ static void encodeAMBE(const IMBE_PARAM* imbe_param, int b[], mbe_parms* cur_mp,
         float sa = (float)imbe_param->sa[i1];
         if (sa < 1) sa = 1.0;
         if (imbe_param->v_uv_dsn[i1])
-            lsa[i1] = log_l_2 + log2f(sa);
+            lsa[i1] = log_l_2 + mbe_log2f(sa);
         else
-            lsa[i1] = log_l_w0 + log2f(sa);
+            lsa[i1] = log_l_w0 + mbe_log2f(sa);
         lsa_sum += lsa[i1];
     }
 
@@ -288,7 +634,7 @@ static void encodeAMBE(const IMBE_PARAM* imbe_param, int b[], mbe_parms* cur_mp,
     }
 
     // DCT
-    const int* J = AmbeLmprbl[imbe_param->num_harms];
+    const int8_t* J = AmbeLmprbl[imbe_param->num_harms];
     float* c[4];
     int acc = 0;
     for (int i = 0; i < 4; i++) {
@@ -296,15 +642,19 @@ static void encodeAMBE(const IMBE_PARAM* imbe_param, int b[], mbe_parms* cur_mp,
         acc += J[i];
     }
 
-    float C[4][17];
+    // only the leading coefficients of each block are quantized (C[i][0..1] feed the PRBA vector,
+    // C[i][2..5] the HOC vectors), so the remaining basis rows are never evaluated
+    float C[4][AMBE_DCT_NUM_COEFFS];
     for (int i = 1; i <= 4; i++) {
-        for (int k = 1; k <= J[i - 1]; k++) {
+        int Ji = J[i - 1];
+        const float* basis = &ambeDctBasis[ambeDctBasisOffset[Ji]];
+        const float* ci = c[i - 1];
+        for (int k = 1; k <= Ji && k <= AMBE_DCT_NUM_COEFFS; k++, basis += Ji) {
             float s = 0.0;
-            for (int j = 1; j <= J[i - 1]; j++) {
-                //fixme: lut?
-                s += (c[i - 1][j - 1] * cosf((M_PI * (((float)k) - 1.0) * (((float)j) - 0.5)) / (float)J[i - 1]));
+            for (int j = 0; j < Ji; j++) {
+                s += ci[j] * basis[j];
             }
-            C[i - 1][k - 1] = s / (float)J[i - 1];
+            C[i - 1][k - 1] = s / (float)Ji;
         }
     }
 
@@ -320,144 +670,36 @@ static void encodeAMBE(const IMBE_PARAM* imbe_param, int b[], mbe_parms* cur_mp,
 
     // encode PRBA
     float G[8];
-    for (int m = 1; m <= 8; m++) {
-        G[m - 1] = 0.0;
-        for (int i = 1; i <= 8; i++) {
-            //fixme: lut?
-            G[m - 1] += (R[i - 1] * cosf((M_PI * (((float)m) - 1.0) * (((float)i) - 0.5)) / 8.0));
-        }
-        G[m - 1] /= 8.0;
-    }
-
-    for (int i = 0; i < 512; i++) {
-        float err = 0.0;
-        float diff;
-
-        diff = G[1] - AmbePRBA24[i][0];
-        err += (diff * diff);
-        diff = G[2] - AmbePRBA24[i][1];
-        err += (diff * diff);
-        diff = G[3] - AmbePRBA24[i][2];
-        err += (diff * diff);
-
-        if (i == 0 || err < error) {
-            error = err;
-            error_index = i;
-        }
-    }
-
-    b[3] = error_index;
-
-    // PRBA58
-    for (int i = 0; i < 128; i++) {
-        float err = 0.0;
-        float diff;
-
-        diff = G[4] - AmbePRBA58[i][0];
-        err += (diff * diff);
-        diff = G[5] - AmbePRBA58[i][1];
-        err += (diff * diff);
-        diff = G[6] - AmbePRBA58[i][2];
-        err += (diff * diff);
-        diff = G[7] - AmbePRBA58[i][3];
-        err += (diff * diff);
-
-        if (i == 0 || err < error) {
-            error = err;
-            error_index = i;
+    for (int m = 0; m < 8; m++) {
+        const float* basis = ambePrbaBasis[m];
+        float s = 0.0;
+        for (int i = 0; i < 8; i++) {
+            s += R[i] * basis[i];
         }
+        G[m] = s / 8.0;
     }
 
-    b[4] = error_index;
+    // PRBA24 and PRBA58
+    b[3] = vqSearch(&G[1], ambePRBA24SoA[0], 512, 512, 3);
+    b[4] = vqSearch(&G[4], ambePRBA58SoA[0], 128, 128, 4);
 
-    // higher order coeffs b5
-    int ii = 1;
-    if (J[ii - 1] <= 2) {
-        b[4 + ii] = 0.0;
-    }
-    else {
-        int max_5 = 32;
-        for (int n = 0; n < max_5; n++) {
-            float err = 0.0;
-            float diff;
-            for (int j = 1; j <= J[ii - 1] - 2 && j <= 4; j++) {
-                diff = AmbeHOCb5[n][j - 1] - C[ii - 1][j + 2 - 1];
-                err += (diff * diff);
-            }
-            if (n == 0 || err < error) {
-                error = err;
-                error_index = n;
-            }
+    // higher order coeffs b5 - b8
+    static const float* const hocCodebooks[4] = { ambeHOCb5SoA[0], ambeHOCb6SoA[0], ambeHOCb7SoA[0], ambeHOCb8SoA[0] };
+    static const int hocSizes[4] = { 32, 16, 16, 8 };
+    for (int ii = 1; ii <= 4; ii++) {
+        if (J[ii - 1] <= 2) {
+            b[4 + ii] = 0;
         }
-        b[4 + ii] = error_index;
-    }
+        else {
+            int dim = J[ii - 1] - 2;
+            if (dim > 4)
+                dim = 4;
 
-    // higher order coeffs b6
-    ii = 2;
-    if (J[ii - 1] <= 2) {
-        b[4 + ii] = 0.0;
-    }
-    else {
-        for (int n = 0; n < 16; n++) {
-            float err = 0.0;
-            float diff;
-            for (int j = 1; j <= J[ii - 1] - 2 && j <= 4; j++) {
-                diff = AmbeHOCb6[n][j - 1] - C[ii - 1][j + 2 - 1];
-                err += (diff * diff);
-            }
-            if (n == 0 || err < error) {
-                error = err;
-                error_index = n;
-            }
+            b[4 + ii] = vqSearch(&C[ii - 1][2], hocCodebooks[ii - 1], hocSizes[ii - 1], hocSizes[ii - 1], dim);
         }
-        b[4 + ii] = error_index;
     }
 
-    // higher order coeffs b7
-    ii = 3;
-    if (J[ii - 1] <= 2) {
-        b[4 + ii] = 0.0;
-    }
-    else {
-        for (int n = 0; n < 16; n++) {
-            float err = 0.0;
-            float diff;
-            for (int j = 1; j <= J[ii - 1] - 2 && j <= 4; j++) {
-                diff = AmbeHOCb7[n][j - 1] - C[ii - 1][j + 2 - 1];
-                err += (diff * diff);
-            }
-            if (n == 0 || err < error) {
-                error = err;
-                error_index = n;
-            }
-        }
-        b[4 + ii] = error_index;
-    }
-
-    // higher order coeffs b8
-    ii = 4;
-    if (J[ii - 1] <= 2) {
-        b[4 + ii] = 0.0;
-    }
-    else {
-        int max_8 = 8;
-        for (int n = 0; n < max_8; n++) {
-            float err = 0.0;
-            float diff;
-            for (int j = 1; j <= J[ii - 1] - 2 && j <= 4; j++) {
-                diff = AmbeHOCb8[n][j - 1] - C[ii - 1][j + 2 - 1];
-                err += (diff * diff);
-            }
-            if (n == 0 || err < error) {
-                error = err;
-                error_index = n;
-            }
-        }
-        b[4 + ii] = error_index;
-    }
-
-    mbe_dequantizeAmbe2250Parms(cur_mp, prev_mp, b);
-    mbe_moveMbeParms(cur_mp, prev_mp);
+    updateAMBEState(prev_mp, b);
 }
 
 /// <summary>
@@ -577,15 +819,33 @@ static void encodeDmrAMBE(const uint8_t* in, uint8_t* out)
 //  Public Class Members
 // ---------------------------------------------------------------------------
 /// <summary>
-/// Initializes a new instance of the MBEDecoder class.
+/// Initializes a new instance of the MBEEncoder class.
 /// </summary>
 /// <param name="mode"></param>
-MBEEncoder::MBEEncoder(MBE_ENCODER_MODE mode) :
+/// <param name="sampleRate">Sample rate of PCM samples given to the stream encoder.</param>
+MBEEncoder::MBEEncoder(MBE_ENCODER_MODE mode, uint32_t sampleRate) :
     m_mbeMode(mode),
+    m_resampler(nullptr),
+    m_streamPCM(),
+    m_streamPCMF(),
+    m_sampleRate(sampleRate),
     m_gainAdjust(0.0f)
 {
-    mbe_parms enh_mp;
-    mbe_initMbeParms(&m_curMBEParms, &m_prevMBEParms, &enh_mp);
+    mbe_parms cur_mp, enh_mp;
+    mbe_initMbeParms(&cur_mp, &m_prevMBEParms, &enh_mp);
+
+    // an unsupported rate is kept as given; the stream encoder then refuses every sample
+    assert(Resampler::isSupportedRate(sampleRate));
+    if (m_sampleRate != MBE_SAMPLE_RATE && Resampler::isSupportedRate(m_sampleRate))
+        m_resampler = new Resampler(m_sampleRate, MBE_SAMPLE_RATE);
+}
+
+/// <summary>
+/// Finalizes a instance of the MBEEncoder class.
+/// </summary>
+MBEEncoder::~MBEEncoder()
+{
+    delete m_resampler;
 }
 
 /// <summary>
@@ -598,27 +858,31 @@ void MBEEncoder::encodeBits(uint8_t bits[], uint8_t codeword[])
 {
     int32_t errs = 0;
     float samples[160U];
-    ::memset(samples, 0x00U, 160U);
+    ::memset(samples, 0x00U, sizeof(samples));
 
     switch (m_mbeMode)
     {
     case ENCODE_DMR_AMBE:
+    case ENCODE_NXDN_AMBE:
     {
         // build 49-bit AMBE bytes
         uint8_t rawAmbe[9U];
         ::memset(rawAmbe, 0x00U, 9U);
 
-        for (int i = 0; i < 9; ++i) {
-            for (int j = 0; j < 8; ++j) {
-                rawAmbe[i] |= (bits[(i * 8) + j] << (7 - j));
-            }
-        }
+        // only the 49 parameter bits are packed; the rest of the frame stays zero
+        for (uint32_t i = 0U; i < 49U; i++)
+            rawAmbe[i >> 3] |= (bits[i] << (7U - (i & 7U)));
 
         // build DMR AMBE bytes
         uint8_t dmrAMBE[9U];
         ::memset(dmrAMBE, 0x00U, 9U);
 
         encodeDmrAMBE(rawAmbe, dmrAMBE);
+
+        // NXDN carries 24 bits of c; the frame bit of the last c bit is not used
+        if (m_mbeMode == ENCODE_NXDN_AMBE)
+            dmrAMBE[8U] &= 0xFEU;
+
         ::memcpy(codeword, dmrAMBE, 9U);
     }
     break;
@@ -656,45 +920,22 @@ void MBEEncoder::encode(int16_t samples[], uint8_t codeword[])
             m_vocoder.set_gain_adjust(m_gainAdjust);
         }
 
-        uint32_t offset = 0U;
-        int16_t mask = 0x0800;
-
-        for (uint32_t i = 0U; i < 12U; i++, mask >>= 1, offset++)
-            WRITE_BIT(codeword, offset, (frame_vector[0U] & mask) != 0);
-
-        mask = 0x0800;
-        for (uint32_t i = 0U; i < 12U; i++, mask >>= 1, offset++)
-            WRITE_BIT(codeword, offset, (frame_vector[1U] & mask) != 0);
-
-        mask = 0x0800;
-        for (uint32_t i = 0U; i < 12U; i++, mask >>= 1, offset++)
-            WRITE_BIT(codeword, offset, (frame_vector[2U] & mask) != 0);
-
-        mask = 0x0800;
-        for (uint32_t i = 0U; i < 12U; i++, mask >>= 1, offset++)
-            WRITE_BIT(codeword, offset, (frame_vector[3U] & mask) != 0);
+        // u0...u3 are 12 bits, u4...u6 are 11 bits and u7 is 7 bits wide
+        uint64_t hi = ((uint64_t)(frame_vector[0U] & 0xFFF) << 36) | ((uint64_t)(frame_vector[1U] & 0xFFF) << 24) |
+            ((uint64_t)(frame_vector[2U] & 0xFFF) << 12) | (uint64_t)(frame_vector[3U] & 0xFFF);
+        uint64_t lo = ((uint64_t)(frame_vector[4U] & 0x7FF) << 29) | ((uint64_t)(frame_vector[5U] & 0x7FF) << 18) |
+            ((uint64_t)(frame_vector[6U] & 0x7FF) << 7) | (uint64_t)(frame_vector[7U] & 0x7F);
 
-        mask = 0x0400;
-        for (uint32_t i = 0U; i < 11U; i++, mask >>= 1, offset++)
-            WRITE_BIT(codeword, offset, (frame_vector[4U] & mask) != 0);
-
-        mask = 0x0400;
-        for (uint32_t i = 0U; i < 11U; i++, mask >>= 1, offset++)
-            WRITE_BIT(codeword, offset, (frame_vector[5U] & mask) != 0);
-
-        mask = 0x0400;
-        for (uint32_t i = 0U; i < 11U; i++, mask >>= 1, offset++)
-            WRITE_BIT(codeword, offset, (frame_vector[6U] & mask) != 0);
-
-        mask = 0x0040;
-        for (uint32_t i = 0U; i < 7U; i++, mask >>= 1, offset++)
-            WRITE_BIT(codeword, offset, (frame_vector[7U] & mask) != 0);
+        for (uint32_t i = 0U; i < 6U; i++)
+            codeword[i] = (uint8_t)(hi >> (40U - (i * 8U)));
+        for (uint32_t i = 0U; i < 5U; i++)
+            codeword[6U + i] = (uint8_t)(lo >> (32U - (i * 8U)));
     }
     else {
-        int b[9];
+        int b[9] = { 0 };
 
         // halfrate audio encoding - output rate is 2450 (49 bits)
-        encodeAMBE(m_vocoder.param(), b, &m_curMBEParms, &m_prevMBEParms, m_gainAdjust);
+        encodeAMBE(m_vocoder.param(), b, &m_prevMBEParms, m_gainAdjust);
 
         uint8_t bits[49U];
         ::memset(bits, 0x00U, 49U);
@@ -705,17 +946,147 @@ void MBEEncoder::encode(int16_t samples[], uint8_t codeword[])
         uint8_t rawAmbe[9U];
         ::memset(rawAmbe, 0x00U, 9U);
 
-        for (int i = 0; i < 9; ++i) {
-            for (int j = 0; j < 8; ++j) {
-                rawAmbe[i] |= (bits[(i * 8) + j] << (7 - j));
-            }
-        }
+        // only the 49 parameter bits are packed; the rest of the frame stays zero
+        for (uint32_t i = 0U; i < 49U; i++)
+            rawAmbe[i >> 3] |= (bits[i] << (7U - (i & 7U)));
 
         // build DMR AMBE bytes
         uint8_t dmrAMBE[9U];
         ::memset(dmrAMBE, 0x00U, 9U);
 
         encodeDmrAMBE(rawAmbe, dmrAMBE);
+
+        // NXDN carries 24 bits of c; the frame bit of the last c bit is not used
+        if (m_mbeMode == ENCODE_NXDN_AMBE)
+            dmrAMBE[8U] &= 0xFEU;
+
         ::memcpy(codeword, dmrAMBE, 9U);
     }
 }
+
+/// <summary>
+/// Returns the length in bytes of a codeword of the encoder mode.
+/// </summary>
+/// <returns></returns>
+uint32_t MBEEncoder::getCodewordLength() const
+{
+    return (m_mbeMode == ENCODE_88BIT_IMBE) ? 11U : 9U;
+}
+
+/// <summary>
+/// Returns the number of codewords ready once the given number of stream samples is added.
+/// </summary>
+/// <param name="count">Number of PCM samples at the stream sample rate.</param>
+/// <returns></returns>
+uint32_t MBEEncoder::getStreamCodewords(uint32_t count) const
+{
+    if (!Resampler::isSupportedRate(m_sampleRate))
+        return 0U;
+
+    uint32_t samples = (m_resampler != nullptr) ? m_resampler->getOutputCount(count) : count;
+    return (uint32_t)((m_streamPCM.size() + samples) / 160U);
+}
+
+/// <summary>
+/// Adds PCM samples at the stream sample rate and encodes every complete frame to MBE codewords.
+/// </summary>
+/// <remarks>
+/// Samples are resampled to 8 kHz and buffered; each 160 sample frame is encoded as encode()
+/// would. Frames beyond maxCodewords stay buffered for the next call.
+/// </remarks>
+/// <param name="samples">PCM samples at the stream sample rate.</param>
+/// <param name="count">Number of PCM samples.</param>
+/// <param name="codewords">Codewords, each getCodewordLength() bytes.</param>
+/// <param name="maxCodewords">Number of codewords that fit in codewords.</param>
+/// <returns>Number of codewords written, or -1 if the stream sample rate is not supported.</returns>
+int32_t MBEEncoder::encodeStream(const int16_t* samples, uint32_t count, uint8_t* codewords, uint32_t maxCodewords)
+{
+    assert(samples != nullptr || count == 0U);
+    assert(codewords != nullptr || maxCodewords == 0U);
+
+    if (!Resampler::isSupportedRate(m_sampleRate))
+        return -1;
+
+    size_t queued = m_streamPCM.size();
+    if (m_resampler != nullptr) {
+        m_streamPCM.resize(queued + m_resampler->getOutputCount(count));
+        if (count > 0U)
+            m_resampler->process(samples, count, m_streamPCM.data() + queued);
+    }
+    else {
+        m_streamPCM.insert(m_streamPCM.end(), samples, samples + count);
+    }
+
+    return (int32_t)encodeFrames(codewords, maxCodewords);
+}
+
+/// <summary>
+/// Adds float PCM samples at the stream sample rate and encodes every complete frame to MBE codewords.
+/// </summary>
+/// <remarks>
+/// Samples are resampled in float and converted to 16-bit once, at 8 kHz, as they are buffered.
+/// </remarks>
+/// <param name="samples">Float PCM samples at the stream sample rate, scaled to +/-1.0.</param>
+/// <param name="count">Number of PCM samples.</param>
+/// <param name="codewords">Codewords, each getCodewordLength() bytes.</param>
+/// <param name="maxCodewords">Number of codewords that fit in codewords.</param>
+/// <returns>Number of codewords written, or -1 if the stream sample rate is not supported.</returns>
+int32_t MBEEncoder::encodeStreamF(const float* samples, uint32_t count, uint8_t* codewords, uint32_t maxCodewords)
+{
+    assert(samples != nullptr || count == 0U);
+    assert(codewords != nullptr || maxCodewords == 0U);
+
+    if (!Resampler::isSupportedRate(m_sampleRate))
+        return -1;
+
+    const float* in = samples;
+    uint32_t length = count;
+    if (m_resampler != nullptr) {
+        length = m_resampler->getOutputCount(count);
+        m_streamPCMF.resize(length);
+        if (count > 0U)
+            m_resampler->process(samples, count, m_streamPCMF.data());
+        in = m_streamPCMF.data();
+    }
+
+    size_t queued = m_streamPCM.size();
+    m_streamPCM.resize(queued + length);
+    if (length > 0U)
+        PCMOps::floatToSamples(in, m_streamPCM.data() + queued, length);
+
+    return (int32_t)encodeFrames(codewords, maxCodewords);
+}
+
+/// <summary>
+/// Discards buffered stream samples and resampler history.
+/// </summary>
+void MBEEncoder::resetStream()
+{
+    m_streamPCM.clear();
+    if (m_resampler != nullptr)
+        m_resampler->reset();
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+/// <summary>
+/// Encodes every complete buffered 8 kHz frame to MBE codewords.
+/// </summary>
+/// <param name="codewords">Codewords, each getCodewordLength() bytes.</param>
+/// <param name="maxCodewords">Number of codewords that fit in codewords.</param>
+/// <returns>Number of codewords written.</returns>
+uint32_t MBEEncoder::encodeFrames(uint8_t* codewords, uint32_t maxCodewords)
+{
+    uint32_t length = getCodewordLength();
+    uint32_t written = 0U;
+    size_t offset = 0U;
+    while (written < maxCodewords && (m_streamPCM.size() - offset) >= 160U) {
+        encode(m_streamPCM.data() + offset, codewords + (written * length));
+        offset += 160U;
+        written++;
+    }
+
+    m_streamPCM.erase(m_streamPCM.begin(), m_streamPCM.begin() + offset);
+    return written;
+}
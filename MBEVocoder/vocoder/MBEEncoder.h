@@ -15,10 +15,12 @@
 #define __MBE_ENCODER_H__
 
 #include "Defines.h"
+#include "Resampler.h"
 #include "mbe.h"
 #include "imbe/imbe_vocoder.h"
 
 #include <stdint.h>
+#include <vector>
 
 namespace vocoder
 {
@@ -29,6 +31,7 @@ namespace vocoder
     enum MBE_ENCODER_MODE {
         ENCODE_DMR_AMBE,
         ENCODE_88BIT_IMBE,  // e.g. IMBE used by P25
+        ENCODE_NXDN_AMBE,
     };
 
     // ---------------------------------------------------------------------------
@@ -39,7 +42,9 @@ namespace vocoder
     class HOST_SW_API MBEEncoder {
     public:
         /// <summary>Initializes a new instance of the MBEEncoder class.</summary>
-        MBEEncoder(MBE_ENCODER_MODE mode);
+        MBEEncoder(MBE_ENCODER_MODE mode, uint32_t sampleRate = MBE_SAMPLE_RATE);
+        /// <summary>Finalizes a instance of the MBEEncoder class.</summary>
+        ~MBEEncoder();
 
         /// <summary>Encodes the given MBE bits to deinterleaved MBE bits using the encoder mode.</summary>
         void encodeBits(uint8_t bits[], uint8_t codeword[]);
@@ -47,14 +52,36 @@ namespace vocoder
         /// <summary>Encodes the given PCM samples using the encoder mode to MBE codewords.</summary>
         void encode(int16_t samples[], uint8_t codeword[]);
 
+        /// <summary>Returns the length in bytes of a codeword of the encoder mode.</summary>
+        uint32_t getCodewordLength() const;
+        /// <summary>Returns the number of codewords ready once the given number of stream samples is added.</summary>
+        uint32_t getStreamCodewords(uint32_t count) const;
+
+        /// <summary>Adds PCM samples at the stream sample rate and encodes every complete frame to MBE codewords.</summary>
+        int32_t encodeStream(const int16_t* samples, uint32_t count, uint8_t* codewords, uint32_t maxCodewords);
+        /// <summary>Adds float PCM samples at the stream sample rate and encodes every complete frame to MBE codewords.</summary>
+        int32_t encodeStreamF(const float* samples, uint32_t count, uint8_t* codewords, uint32_t maxCodewords);
+        /// <summary>Discards buffered stream samples and resampler history.</summary>
+        void resetStream();
+
     private:
         imbe_vocoder m_vocoder;
-        mbe_parms m_curMBEParms;
         mbe_parms m_prevMBEParms;
 
         MBE_ENCODER_MODE m_mbeMode;
 
+        Resampler* m_resampler;
+        // 8 kHz samples waiting for a complete frame
+        std::vector<int16_t> m_streamPCM;
+        // resampled float samples before conversion to 16-bit
+        std::vector<float> m_streamPCMF;
+
+        /// <summary>Encodes every complete buffered 8 kHz frame to MBE codewords.</summary>
+        uint32_t encodeFrames(uint8_t* codewords, uint32_t maxCodewords);
+
     public:
+        /// <summary>Sample rate of PCM samples given to the stream encoder.</summary>
+        __READONLY_PROPERTY(uint32_t, sampleRate, SampleRate);
         /// <summary></summary>
         __PROPERTY(float, gainAdjust, GainAdjust);
     };
@@ -31,6 +31,8 @@
 #include <math.h>
 
 #include "vocoder/mbe.h"
+#include "vocoder/mbe_math.h"
+#include "vocoder/ambe3600x2450_const.h"
 
 #ifdef _MSC_VER
 #pragma warning(disable: 4244)
@@ -40,25 +42,6 @@
 #pragma GCC diagnostic ignored "-Wunused-but-set-variable"
 #endif
 
-// ---------------------------------------------------------------------------
-//  Externs
-// ---------------------------------------------------------------------------
-
-/*
-** these are all declared by include in ambe3600x2450.c
-*/
-extern const float AmbeW0table[120];
-extern const float AmbeLtable[120];
-extern const int AmbeVuv[32][8];
-extern const int AmbeLmprbl[57][4];
-extern const float AmbeDg[32];
-extern const float AmbePRBA24[512][3];
-extern const float AmbePRBA58[128][4];
-extern const float AmbeHOCb5[32][4];
-extern const float AmbeHOCb6[16][4];
-extern const float AmbeHOCb7[16][4];
-extern const float AmbeHOCb8[8][4];
-
 // ---------------------------------------------------------------------------
 //  Global Functions
 // ---------------------------------------------------------------------------
@@ -198,7 +181,7 @@ int mbe_dequantizeAmbe2250Parms(mbe_parms* cur_mp, mbe_parms* prev_mp, const int
             else {
                 am = 2;
             }
-            sum = sum + ((float)am * Gm[m] * cosf((M_PI * (float)(m - 1) * ((float)i - (float)0.5)) / (float)8));
+            sum = sum + ((float)am * Gm[m] * mbe_cosf((M_PI * (float)(m - 1) * ((float)i - (float)0.5)) / (float)8));
         }
 
         Ri[i] = sum;
@@ -298,7 +281,7 @@ int mbe_dequantizeAmbe2250Parms(mbe_parms* cur_mp, mbe_parms* prev_mp, const int
 #ifdef AMBE_DEBUG
                 fprintf(stderr, "MBE: AMBE: %i Cik[%i][%i]: %f", j, i, k, Cik[i][k]);
 #endif
-                sum = sum + ((float)ak * Cik[i][k] * cosf((M_PI * (float)(k - 1) * ((float)j - (float)0.5)) / (float)ji));
+                sum = sum + ((float)ak * Cik[i][k] * mbe_cosf((M_PI * (float)(k - 1) * ((float)j - (float)0.5)) / (float)ji));
             }
             Tl[l] = sum;
 #ifdef AMBE_DEBUG
@@ -360,10 +343,10 @@ int mbe_dequantizeAmbe2250Parms(mbe_parms* cur_mp, mbe_parms* prev_mp, const int
         cur_mp->log2Ml[l] = Tl[l] + c1 + c2 - Sum43 + BigGamma;
         // inverse log to generate spectral amplitudes
         if (cur_mp->Vl[l] == 1) {
-            cur_mp->Ml[l] = exp((float)0.693 * cur_mp->log2Ml[l]);
+            cur_mp->Ml[l] = mbe_expf((float)0.693 * cur_mp->log2Ml[l]);
         }
         else {
-            cur_mp->Ml[l] = unvc * exp((float)0.693 * cur_mp->log2Ml[l]);
+            cur_mp->Ml[l] = unvc * mbe_expf((float)0.693 * cur_mp->log2Ml[l]);
         }
 #ifdef AMBE_DEBUG
         fprintf(stderr, "MBE: AMBE: flokl[%i]: %f, intkl[%i]: %i", l, flokl[l], l, intkl[l]);
@@ -32,6 +32,7 @@
 #include <math.h>
 
 #include "vocoder/mbe.h"
+#include "vocoder/mbe_math.h"
 #include "vocoder/ambe3600x2400_const.h"
 
 #ifdef _MSC_VER
@@ -343,7 +344,7 @@ int mbe_decodeAmbe2400Parms(char* ambe_d, mbe_parms* cur_mp, mbe_parms* prev_mp)
             else {
                 am = 2;
             }
-            sum = sum + ((float)am * Gm[m] * cosf((M_PI * (float)(m - 1) * ((float)i - (float)0.5)) / (float)8));
+            sum = sum + ((float)am * Gm[m] * mbe_cosf((M_PI * (float)(m - 1) * ((float)i - (float)0.5)) / (float)8));
         }
         Ri[i] = sum;
 #ifdef AMBE_DEBUG
@@ -469,7 +470,7 @@ int mbe_decodeAmbe2400Parms(char* ambe_d, mbe_parms* cur_mp, mbe_parms* prev_mp)
 #ifdef AMBE_DEBUG
                 fprintf(stderr, "MBE: AMBE: j: %i Cik[%i][%i]: %f ", j, i, k, Cik[i][k]);
 #endif
-                sum = sum + ((float)ak * Cik[i][k] * cosf((M_PI * (float)(k - 1) * ((float)j - (float)0.5)) / (float)ji));
+                sum = sum + ((float)ak * Cik[i][k] * mbe_cosf((M_PI * (float)(k - 1) * ((float)j - (float)0.5)) / (float)ji));
             }
             Tl[l] = sum;
 #ifdef AMBE_DEBUG
@@ -532,11 +533,11 @@ int mbe_decodeAmbe2400Parms(char* ambe_d, mbe_parms* cur_mp, mbe_parms* prev_mp)
         // inverse log to generate spectral amplitudes
         if (cur_mp->Vl[l] == 1)
         {
-            cur_mp->Ml[l] = exp((float)0.693 * cur_mp->log2Ml[l]);
+            cur_mp->Ml[l] = mbe_expf((float)0.693 * cur_mp->log2Ml[l]);
         }
         else
         {
-            cur_mp->Ml[l] = unvc * exp((float)0.693 * cur_mp->log2Ml[l]);
+            cur_mp->Ml[l] = unvc * mbe_expf((float)0.693 * cur_mp->log2Ml[l]);
         }
 #ifdef AMBE_DEBUG
         fprintf(stderr, "MBE: AMBE: flokl[%i]: %f, intkl[%i]: %i", l, flokl[l], l, intkl[l]);
@@ -555,30 +556,21 @@ int mbe_decodeAmbe2400Parms(char* ambe_d, mbe_parms* cur_mp, mbe_parms* prev_mp)
 /// <param name="ambe_fr"></param>
 void mbe_demodulateAmbe3600x2400Data(char ambe_fr[4][24])
 {
-    int i, j, k;
-    unsigned short pr[115];
+    int i, j;
+    unsigned int pr;
     unsigned short foo = 0;
 
-    // create pseudo-random modulator
+    // look up pseudo-random modulator
     for (i = 23; i >= 12; i--) {
         foo <<= 1;
         foo |= ambe_fr[0][i];
     }
 
-    pr[0] = (16 * foo);
-    for (i = 1; i < 24; i++) {
-        pr[i] = (173 * pr[i - 1]) + 13849 - (65536 * (((173 * pr[i - 1]) + 13849) / 65536));
-    }
-
-    for (i = 1; i < 24; i++) {
-        pr[i] = pr[i] / 32768;
-    }
+    pr = mbe_ambeWhitening(foo);
 
     // demodulate ambe_fr with pr
-    k = 1;
     for (j = 22; j >= 0; j--) {
-        ambe_fr[1][j] = ((ambe_fr[1][j]) ^ pr[k]);
-        k++;
+        ambe_fr[1][j] = ((ambe_fr[1][j]) ^ ((pr >> j) & 1));
     }
 }
 
@@ -628,10 +620,12 @@ void mbe_processAmbe2400DataF(float* aout_buf, int* errs, int* errs2, char* err_
 
     if (bad == 0) {
         if (cur_mp->repeat <= 3) {
-            mbe_moveMbeParms(cur_mp, prev_mp);
-            mbe_spectralAmpEnhance(cur_mp);
-            mbe_synthesizeSpeechf(aout_buf, cur_mp, prev_mp_enhanced, uvquality);
-            mbe_moveMbeParms(cur_mp, prev_mp_enhanced);
+            // a repeated frame is already a copy of prev_mp
+            if (cur_mp->repeat == 0)
+                mbe_moveMbeParms(cur_mp, prev_mp);
+            else
+                prev_mp->repeat = cur_mp->repeat;
+            mbe_synthesizeEnhancedSpeechf(aout_buf, cur_mp, prev_mp_enhanced, uvquality);
         }
         else {
             *err_str = 'M';
@@ -29,6 +29,7 @@
 #define _USE_MATH_DEFINES
 #include <math.h>
 
+#include "vocoder/mbe.h"
 #include "vocoder/ecc_const.h"
 
 // ---------------------------------------------------------------------------
@@ -40,28 +41,8 @@
 /// <param name="block"></param>
 void mbe_checkGolayBlock(long int* block)
 {
-    static int i, syndrome, eccexpected, eccbits, databits;
-    long int mask, block_l;
-
-    block_l = *block;
-
-    mask = 0x400000l;
-    eccexpected = 0;
-    for (i = 0; i < 12; i++) {
-        if ((block_l & mask) != 0l) {
-            eccexpected ^= golayGenerator[i];
-        }
-
-        mask = mask >> 1;
-    }
-
-    eccbits = (int)(block_l & 0x7ffl);
-    syndrome = eccexpected ^ eccbits;
-
-    databits = (int)(block_l >> 11);
-    databits = databits ^ golayMatrix[syndrome];
-
-    *block = (long)databits;
+    // the table-driven Golay (23,12,7) decoder corrects the same error patterns
+    *block = (long)mbe_golayDecode23127((unsigned int)(*block & 0x7fffffl));
 }
 
 /// <summary>
@@ -21,10 +21,109 @@
 
 #include "vocoder/imbe/typedef.h"
 #include "vocoder/imbe/basic_op.h"
+#include "vocoder/imbe/globals.h"
 #include "vocoder/imbe/imbe.h"
 #include "vocoder/imbe/aux_sub.h"
 #include "vocoder/imbe/tbls.h"
 
+// ---------------------------------------------------------------------------
+//  Globals
+// ---------------------------------------------------------------------------
+
+static FV_BIT_MAP fv_map_tbl[NUM_HARMS_MAX - NUM_HARMS_MIN + 1][FV_MAP_LEN];
+
+// ---------------------------------------------------------------------------
+//  Static Functions
+// ---------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//	PURPOSE:
+//		Build frame vector bit maps for all numbers of harmonics by
+//      running the priority scanning once
+//
+//  INPUT:
+//		None
+//
+//	OUTPUT:
+//		Filled fv_map_tbl
+//
+//	RETURN:
+//		Always true
+//
+//-----------------------------------------------------------------------------
+static bool build_frame_vector_maps(void)
+{
+    Word16 bit_alloc[B_NUM + 4];
+    UWord8 s_num[FV_MAP_LEN + B_NUM], s_bit[FV_MAP_LEN + B_NUM];
+    Word16 num_harms, num_bands, index0, bit_thr, i, p, q;
+    FV_BIT_MAP* map;
+
+    for (num_harms = NUM_HARMS_MIN; num_harms <= NUM_HARMS_MAX; num_harms++) {
+        if (num_harms <= 36)
+            num_bands = extract_h((UWord32)(num_harms + 2) * CNST_0_33_Q0_16);   // fix((L+2)/3)
+        else
+            num_bands = NUM_BANDS_MAX;
+
+        get_bit_allocation(num_harms, bit_alloc);
+
+        // Priority Scanning of b3...bL+1
+        index0 = 0;
+        bit_thr = (num_harms == 0xb) ? 9 : bit_alloc[0];
+        while (index0 < FV_MAP_LEN - num_bands - 2 && bit_thr > 0) {
+            for (i = 0; i < num_harms - 1; i++) {
+                if (bit_thr <= bit_alloc[i]) {
+                    s_num[index0] = 3 + i;
+                    s_bit[index0] = bit_thr - 1;
+                    index0++;
+                }
+            }
+            bit_thr--;
+        }
+
+        // u0 bits 2..0, u1...u3 carry the first 39 bits of the scanned sequence, u4...u6 and
+        // u7 bits 6..4 carry b1, b2 bits 2..1 and the rest of the sequence
+        map = fv_map_tbl[num_harms - NUM_HARMS_MIN];
+        for (p = 0; p < FV_MAP_LEN; p++, map++) {
+            if (p < 3) {
+                map->vec_num = 0;
+                map->vec_bit = 2 - p;
+            }
+            else if (p < 3 + 3 * 12) {
+                map->vec_num = 1 + (p - 3) / 12;
+                map->vec_bit = 11 - (p - 3) % 12;
+            }
+            else if (p < 3 + 3 * 12 + 3 * 11) {
+                map->vec_num = 4 + (p - 39) / 11;
+                map->vec_bit = 10 - (p - 39) % 11;
+            }
+            else {
+                map->vec_num = 7;
+                map->vec_bit = 6 - (p - 72);
+            }
+
+            q = p - (3 + 3 * 12);
+            if (q < 0) {
+                map->b_num = s_num[p];
+                map->b_bit = s_bit[p];
+            }
+            else if (q < num_bands) {
+                map->b_num = 1;
+                map->b_bit = num_bands - 1 - q;
+            }
+            else if (q < num_bands + 2) {
+                map->b_num = 2;
+                map->b_bit = 2 - (q - num_bands);
+            }
+            else {
+                map->b_num = s_num[p - num_bands - 2];
+                map->b_bit = s_bit[p - num_bands - 2];
+            }
+        }
+    }
+
+    return true;
+}
+
 // ---------------------------------------------------------------------------
 // Global Functions
 // ---------------------------------------------------------------------------
@@ -89,6 +188,30 @@ void get_bit_allocation(Word16 num_harms, Word16* ptr)
     }
 }
 
+//-----------------------------------------------------------------------------
+//	PURPOSE:
+//		Return pointer to frame vector bit map according to the number
+//      of harmonics. The map gives the b_vec bit for every frame vector
+//      bit that is placed by priority scanning (b1, b2 bits 2..1, b3...bL+1)
+//
+//  INPUT:
+//		num_harms - The number of harmonics
+//
+//	OUTPUT:
+//		None
+//
+//	RETURN:
+//		Pointer to FV_MAP_LEN bit map items
+//
+//-----------------------------------------------------------------------------
+const FV_BIT_MAP* get_frame_vector_map(Word16 num_harms)
+{
+    static const bool init = build_frame_vector_maps();
+    (void)init;
+
+    return fv_map_tbl[num_harms - NUM_HARMS_MIN];
+}
+
 //-----------------------------------------------------------------------------
 //	PURPOSE:
 //		Set the elements of a 16 bit input vector to zero.
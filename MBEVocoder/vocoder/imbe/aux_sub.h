@@ -59,6 +59,24 @@ const UWord16 *get_bit_allocation_arr(Word16 num_harms);
 //-----------------------------------------------------------------------------
 void get_bit_allocation(Word16 num_harms, Word16 *ptr);
 
+//-----------------------------------------------------------------------------
+//	PURPOSE:
+//		Return pointer to frame vector bit map according to the number
+//      of harmonics. The map gives the b_vec bit for every frame vector
+//      bit that is placed by priority scanning (b1, b2 bits 2..1, b3...bL+1)
+//
+//  INPUT:
+//		num_harms - The number of harmonics
+//
+//	OUTPUT:
+//		None
+//
+//	RETURN:
+//		Pointer to FV_MAP_LEN bit map items
+//
+//-----------------------------------------------------------------------------
+const FV_BIT_MAP *get_frame_vector_map(Word16 num_harms);
+
 //-----------------------------------------------------------------------------
 //	PURPOSE:
 //		Set the elements of a 16 bit input vector to zero.
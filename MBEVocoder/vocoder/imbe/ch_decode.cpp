@@ -32,9 +32,9 @@
 
 void decode_frame_vector(IMBE_PARAM* imbe_param, Word16* frame_vector)
 {
-    Word16 bit_stream[BIT_STREAM_LEN];
-    Word16 i, vec_num, tmp, tmp1, tmp2, bit_thr, shift;
-    Word16* b_ptr, *ba_ptr, index0;
+    const FV_BIT_MAP* map;
+    Word16 i, tmp, tmp1, tmp2, shift;
+    Word16* b_ptr, *ba_ptr;
     Word32 L_tmp;
 
     imbe_param->b_vec[0] = (shr(frame_vector[0], 4) & 0xFC) | (shr(frame_vector[7], 1) & 0x3);
@@ -68,74 +68,23 @@ void decode_frame_vector(IMBE_PARAM* imbe_param, Word16* frame_vector)
     else
         imbe_param->num_bands = NUM_BANDS_MAX;
 
-    // Convert input vector (from b_3 to b_L+1) to bit stream
-    bit_stream[0] = (frame_vector[0] & 0x4) ? 1 : 0;
-    bit_stream[1] = (frame_vector[0] & 0x2) ? 1 : 0;
-    bit_stream[2] = (frame_vector[0] & 0x1) ? 1 : 0;
-
-    bit_stream[BIT_STREAM_LEN - 3] = (frame_vector[7] & 0x40) ? 1 : 0;
-    bit_stream[BIT_STREAM_LEN - 2] = (frame_vector[7] & 0x20) ? 1 : 0;
-    bit_stream[BIT_STREAM_LEN - 1] = (frame_vector[7] & 0x10) ? 1 : 0;
-
-
-    index0 = 3 + 3 * 12 - 1;
-    for (vec_num = 3; vec_num >= 1; vec_num--) {
-        tmp = frame_vector[vec_num];
-        for (i = 0; i < 12; i++) {
-            bit_stream[index0] = (tmp & 0x1) ? 1 : 0;
-            tmp >>= 1;
-            index0--;
-        }
-    }
-
-    index0 = 3 + 3 * 12 + 3 * 11 - 1;
-    for (vec_num = 6; vec_num >= 4; vec_num--) {
-        tmp = frame_vector[vec_num];
-        for (i = 0; i < 11; i++) {
-            bit_stream[index0] = (tmp & 0x1) ? 1 : 0;
-            tmp >>= 1;
-            index0--;
-        }
-    }
-
-    // Rebuild b1
-    index0 = 3 + 3 * 12;
-    tmp = 0;
-    for (i = 0; i < imbe_param->num_bands; i++)
-        tmp = (tmp << 1) | bit_stream[index0++];
-
-    imbe_param->b_vec[1] = tmp;
-
-    // Rebuild b2
-    tmp = 0;
-    tmp |= bit_stream[index0++] << 1;
-    tmp |= bit_stream[index0++];
-    imbe_param->b_vec[2] = (frame_vector[0] & 0x38) | (tmp << 1) | (shr(frame_vector[7], 3) & 0x01);
-
-    // Shift the rest of sequence
-    tmp = imbe_param->num_bands + 2;            // shift
-    for (; index0 < BIT_STREAM_LEN; index0++)
-        bit_stream[index0 - tmp] = bit_stream[index0];
-
     // Priority ReScanning
     b_ptr = &imbe_param->b_vec[3];
     ba_ptr = imbe_param->bit_alloc;
     for (i = 0; i < B_NUM; i++)
         ba_ptr[i] = b_ptr[i] = 0;
 
-
     // Unpack bit allocation table's item
     get_bit_allocation(imbe_param->num_harms, imbe_param->bit_alloc);
 
-    index0 = 0;
-    bit_thr = (imbe_param->num_harms == 0xb) ? 9 : ba_ptr[0];
+    // Rebuild b1, b2 bits 2..1 and b3...bL+1 by the precalculated bit map
+    imbe_param->b_vec[1] = imbe_param->b_vec[2] = 0;
+    map = get_frame_vector_map(imbe_param->num_harms);
+    for (i = 0; i < FV_MAP_LEN; i++, map++)
+        imbe_param->b_vec[map->b_num] |= ((frame_vector[map->vec_num] >> map->vec_bit) & 1) << map->b_bit;
 
-    while (index0 < BIT_STREAM_LEN - imbe_param->num_bands - 2) {
-        for (i = 0; i < imbe_param->num_harms - 1; i++)
-            if (bit_thr && bit_thr <= ba_ptr[i])
-                b_ptr[i] = (b_ptr[i] << 1) | bit_stream[index0++];
-        bit_thr--;
-    }
+    // Rebuild b2
+    imbe_param->b_vec[2] |= (frame_vector[0] & 0x38) | (shr(frame_vector[7], 3) & 0x01);
 
     // Synchronization Bit Decoding
     imbe_param->b_vec[imbe_param->num_harms + 2] = frame_vector[7] & 1;
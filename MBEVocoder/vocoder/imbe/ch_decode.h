@@ -23,12 +23,6 @@
 
 #include "vocoder/imbe/typedef.h"
 
-// ---------------------------------------------------------------------------
-//	 Macros
-// ---------------------------------------------------------------------------
-
-#define BIT_STREAM_LEN  (3 + 3*12 + 3*11 + 3)
-
 // ---------------------------------------------------------------------------
 //	 Global Functions
 // ---------------------------------------------------------------------------
@@ -21,12 +21,6 @@
 #ifndef __CH_ENCODE_H__
 #define __CH_ENCODE_H__
 
-// ---------------------------------------------------------------------------
-//	 Macros
-// ---------------------------------------------------------------------------
-
-#define EN_BIT_STREAM_LEN  (3 + 3*12 + 6 + 2*11 + 3)
-
 // ---------------------------------------------------------------------------
 //	 Global Functions
 // ---------------------------------------------------------------------------
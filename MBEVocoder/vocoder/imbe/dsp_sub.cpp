@@ -51,31 +51,20 @@
 //-----------------------------------------------------------------------------
 void imbe_vocoder::idct(Word16* in, Word16 m_lim, Word16 i_lim, Word16* out)
 {
-    UWord16 angl_step, angl_intl, angl_intl_2;
-    UWord16 angl_acc;
+    const Word16* basis;
     Word32  sum;
     Word16  i, m;
 
-    if (m_lim == 1) {
-        angl_intl = CNST_0_5_Q1_15;
-        angl_intl_2 = CNST_1_0_Q1_15;
-    }
-    else {
-        angl_intl = div_s((Word16)CNST_0_5_Q5_11, m_lim << 11); // calculate 0.5/m_lim
-        angl_intl_2 = shl(angl_intl, 1);
-    }
-
-    angl_step = angl_intl;
+    basis = &idct_tbl[dct_tbl_offset[m_lim - 1]];
     for (i = 0; i < i_lim; i++) {
+        // |basis| < 1 so L_mult() can not saturate and the sum can not overflow,
+        // (in * basis) >> 6 is equal to L_shr(L_mult(in, basis), 7)
         sum = 0;
-        angl_acc = angl_step;
-        for (m = 1; m < m_lim; m++) {
-            sum = L_add(sum, L_shr(L_mult(in[m], cos_fxp(angl_acc)), 7));
-            angl_acc += angl_step;
-        }
+        for (m = 1; m < m_lim; m++)
+            sum += ((Word32)in[m] * basis[m]) >> 6;
         sum = L_add(sum, L_shr(L_deposit_h(in[0]), 8));
         out[i] = extract_l(L_shr_r(sum, 8));
-        angl_step += angl_intl_2;
+        basis += m_lim;
     }
 }
 
@@ -99,19 +88,15 @@ void imbe_vocoder::idct(Word16* in, Word16 m_lim, Word16 i_lim, Word16* out)
 //-----------------------------------------------------------------------------
 void imbe_vocoder::dct(Word16* in, Word16 m_lim, Word16 i_lim, Word16* out)
 {
-    UWord16 angl_step, angl_intl, angl_intl_2, angl_begin;
-    UWord16 angl_acc;
+    UWord16 angl_intl_2;
+    const Word16* basis;
     Word32  sum;
     Word16  i, m;
 
-    if (m_lim == 1) {
-        angl_intl = CNST_0_5_Q1_15;
+    if (m_lim == 1)
         angl_intl_2 = CNST_1_0_Q1_15;
-    }
-    else {
-        angl_intl = div_s((Word16)CNST_0_5_Q5_11, m_lim << 11); // calculate 0.5/m_lim
-        angl_intl_2 = shl(angl_intl, 1);
-    }
+    else
+        angl_intl_2 = shl(div_s((Word16)CNST_0_5_Q5_11, m_lim << 11), 1); // calculate 1/m_lim
 
     // Calculate first coefficient
     sum = 0;
@@ -120,19 +105,15 @@ void imbe_vocoder::dct(Word16* in, Word16 m_lim, Word16 i_lim, Word16* out)
     out[0] = extract_l(L_mpy_ls(sum, angl_intl_2));
 
     // Calculate the others coefficients
-    angl_begin = angl_intl;
-    angl_step = angl_intl_2;
+    // |basis| < 1 so mult() can not saturate and the sum can not overflow,
+    // (in * basis) >> 15 is equal to mult(in, basis)
+    basis = &dct_tbl[dct_tbl_offset[m_lim - 1] + m_lim];
     for (i = 1; i < i_lim; i++) {
         sum = 0;
-        angl_acc = angl_begin;
-        for (m = 0; m < m_lim; m++) {
-            sum = L_add(sum, L_deposit_l(mult(in[m], cos_fxp(angl_acc))));
-            angl_acc += angl_step;
-        }
+        for (m = 0; m < m_lim; m++)
+            sum += ((Word32)in[m] * basis[m]) >> 15;
         out[i] = extract_l(L_mpy_ls(sum, angl_intl_2));
-
-        angl_step += angl_intl_2;
-        angl_begin += angl_intl;
+        basis += m_lim;
     }
 }
 
@@ -38,8 +38,9 @@
 
 void imbe_vocoder::encode_init(void)
 {
-    v_zap(pitch_est_buf, PITCH_EST_BUF_SIZE);
-    v_zap(pitch_ref_buf, PITCH_EST_BUF_SIZE);
+    v_zap(pitch_est_buf, PITCH_EST_BUF_LEN);
+    v_zap(pitch_ref_buf, PITCH_EST_BUF_LEN);
+    pitch_buf_pos = 0;
     v_zap(pe_lpf_mem, PE_LPF_ORD);
     pitch_est_init();
     fft_init();
@@ -52,22 +53,31 @@ void imbe_vocoder::encode(IMBE_PARAM* imbe_param, Word16* frame_vector, Word16*
 {
     Word16 i;
     Word16* wr_ptr, *sig_ptr;
+    Word16* est_buf, *ref_buf;
 
-    for (i = 0; i < PITCH_EST_BUF_SIZE - FRAME; i++) {
-        pitch_est_buf[i] = pitch_est_buf[i + FRAME];
-        pitch_ref_buf[i] = pitch_ref_buf[i + FRAME];
+    // Advance the analysis window by one frame; the history is only moved back
+    // to the start of the buffers once the slack space has been used up
+    if (pitch_buf_pos + PITCH_EST_BUF_SIZE + FRAME > PITCH_EST_BUF_LEN) {
+        v_equ(pitch_est_buf, &pitch_est_buf[pitch_buf_pos + FRAME], PITCH_EST_BUF_SIZE - FRAME);
+        v_equ(pitch_ref_buf, &pitch_ref_buf[pitch_buf_pos + FRAME], PITCH_EST_BUF_SIZE - FRAME);
+        pitch_buf_pos = 0;
     }
+    else
+        pitch_buf_pos += FRAME;
 
-    dc_rmv(snd, &pitch_ref_buf[PITCH_EST_BUF_SIZE - FRAME], &dc_rmv_mem, FRAME);
-    pe_lpf(&pitch_ref_buf[PITCH_EST_BUF_SIZE - FRAME], &pitch_est_buf[PITCH_EST_BUF_SIZE - FRAME], pe_lpf_mem, FRAME);
+    est_buf = &pitch_est_buf[pitch_buf_pos];
+    ref_buf = &pitch_ref_buf[pitch_buf_pos];
 
-    pitch_est(imbe_param, pitch_est_buf);
+    dc_rmv(snd, &ref_buf[PITCH_EST_BUF_SIZE - FRAME], &dc_rmv_mem, FRAME);
+    pe_lpf(&ref_buf[PITCH_EST_BUF_SIZE - FRAME], &est_buf[PITCH_EST_BUF_SIZE - FRAME], pe_lpf_mem, FRAME);
+
+    pitch_est(imbe_param, est_buf);
 
     //
     // Speech windowing and FFT calculation
     //
     wr_ptr = (Word16*)wr;
-    sig_ptr = &pitch_ref_buf[40];
+    sig_ptr = &ref_buf[40];
     for (i = 146; i < 256; i++) {
         fft_buf[i].re = mult(*sig_ptr++, *wr_ptr++);
         fft_buf[i].im = 0;
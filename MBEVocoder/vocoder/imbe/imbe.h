@@ -42,6 +42,13 @@
 
 #define PITCH_EST_BUF_SIZE  621
 
+#define FV_MAP_LEN  (3 + 3*12 + 3*11 + 3)   // Number of frame vector bits placed by priority scanning
+
+// Pitch analysis history is kept in a sliding buffer with room for this many extra frames,
+// so the analysis window is advanced by offset and only compacted once the buffer is full
+#define PITCH_EST_BUF_SLACK   8
+#define PITCH_EST_BUF_LEN   (PITCH_EST_BUF_SIZE + PITCH_EST_BUF_SLACK * FRAME)
+
 // ---------------------------------------------------------------------------
 //	 Types
 // ---------------------------------------------------------------------------
@@ -67,4 +74,11 @@ typedef struct {
 	Word16 im;
 } Cmplx16;
 
+typedef struct {
+	UWord8 vec_num;               // frame vector item
+	UWord8 vec_bit;               // bit within the frame vector item
+	UWord8 b_num;                 // b_vec item
+	UWord8 b_bit;                 // bit within the b_vec item
+} FV_BIT_MAP;
+
 #endif // __IMBE_H__
@@ -39,6 +39,7 @@ imbe_vocoder::imbe_vocoder(void) :
     num_harms_prev3(0),
     fund_freq_prev(0),
     th_max(0),
+    pitch_buf_pos(0),
     dc_rmv_mem(0),
     d_gain_adjust(0)
 {
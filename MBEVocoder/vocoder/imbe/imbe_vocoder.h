@@ -80,8 +80,9 @@ private:
     Word16 v_uv_dsn[NUM_BANDS_MAX];
     Word16 wr_array[FFTLENGTH / 2 + 1];
     Word16 wi_array[FFTLENGTH / 2 + 1];
-    Word16 pitch_est_buf[PITCH_EST_BUF_SIZE];
-    Word16 pitch_ref_buf[PITCH_EST_BUF_SIZE];
+    Word16 pitch_est_buf[PITCH_EST_BUF_LEN];
+    Word16 pitch_ref_buf[PITCH_EST_BUF_LEN];
+    Word16 pitch_buf_pos;
     Word32 dc_rmv_mem;
     Cmplx16 fft_buf[FFTLENGTH];
     Word16 pe_lpf_mem[PE_LPF_ORD];
@@ -77,11 +77,18 @@ Word32 deqnt_by_step(Word16 qval, UWord16 step_size, Word16 bit_num)
 Word16 qnt_by_step(Word16 val, UWord16 step_size, Word16 bit_num)
 {
     Word16 index, min_val, max_val;
-    Word16 q_index, shift, tmp;
+    Word16 q_index, shift, tmp, den;
 
     shift = norm_s(step_size);
 
-    tmp = div_s(0x4000, shl(step_size, shift));     // Remark: To get result in Qxx.16 format it is necessary left shift tmp by (shift + 3) 
+    // Remark: To get result in Qxx.16 format it is necessary left shift tmp by (shift + 3)
+    // The normalized step size is in range 0x4000...0x7FFF, so a single integer division
+    // gives exactly the same result as div_s(0x4000, den)
+    den = shl(step_size, shift);
+    if (den == 0x4000)
+        tmp = MAX_16;
+    else
+        tmp = (Word16)(0x20000000L / den);
     q_index = shr_r(mult(val, tmp), sub(9, shift)); // q_index here is rounded to the nearest integer
 
     max_val = 1 << (bit_num - 1);
@@ -147,6 +147,157 @@ const UWord32 lmprbl_tbl[] =
 
 
 
+//-----------------------------------------------------------------------------
+//
+// DCT/IDCT basis in Q1.15 format for every block length 1...MAX_BLOCK_LEN.
+// Row i of the basis for block length L starts at dct_tbl_offset[L - 1] + i * L
+//
+//-----------------------------------------------------------------------------
+const Word16 dct_tbl_offset[] =
+{
+    0, 1, 5, 14, 30, 55, 91, 140, 204, 285, 385
+};
+
+const Word16 dct_tbl[] =
+{
+    // length 1
+     32767,
+    // length 2
+     32767, 32767,
+     23170,-23172,
+    // length 3
+     32767, 32767, 32767,
+     28378,     3,-28376,
+     16385,-32766, 16374,
+    // length 4
+     32767, 32767, 32767, 32767,
+     30274, 12540,-12542,-30275,
+     23170,-23172,-23172, 23170,
+     12540,-30275, 30274,-12542,
+    // length 5
+     32767, 32767, 32767, 32767, 32767,
+     31164, 19266,    12,-19248,-31157,
+     26512,-10114,-32766,-10162, 26482,
+     19266,-31157,   -40, 31179,-19207,
+     10135,-26529, 32766,-26469, 10039,
+    // length 6
+     32767, 32767, 32767, 32767, 32767, 32767,
+     31651, 23174,  8490, -8469,-23158,-31645,
+     28379,    12,-28368,-28393,   -40, 28354,
+     23174,-23158,-23194, 23138, 23209,-23123,
+     16390,-32766, 16347, 16434,-32766, 16303,
+      8490,-23194, 31664,-31632, 23102, -8372,
+    // length 7
+     32767, 32767, 32767, 32767, 32767, 32767, 32767,
+     31946, 25622, 14225,    12,-14205,-25608,-31941,
+     29524,  7302,-20418,-32766,-20457,  7253, 29502,
+     25622,-14205,-31952,   -40, 31935, 14270,-25577,
+     20435,-29514, -7329, 32766, -7231,-29558, 20356,
+     14225,-31952, 25590,    62,-25670, 31923,-14114,
+      7302,-20457, 29545,-32766, 29480,-20339,  7155,
+    // length 8
+     32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+     32138, 27246, 18205,  6393, -6396,-18207,-27247,-32138,
+     30274, 12540,-12542,-30275,-30275,-12542, 12540, 30274,
+     27246, -6396,-32138,-18207, 18205, 32138,  6393,-27247,
+     23170,-23172,-23172, 23170, 23170,-23172,-23172, 23170,
+     18205,-32138,  6393, 27246,-27247, -6396, 32138,-18207,
+     12540,-30275, 30274,-12542,-12542, 30274,-30275, 12540,
+      6393,-18207, 27246,-32138, 32138,-27247, 18205, -6396,
+    // length 9
+     32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+     32270, 28379, 21068, 11216,    12,-11195,-21051,-28368,-32266,
+     30792, 16390, -5679,-25091,-32766,-25123, -5728, 16347, 30775,
+     28379,    12,-28368,-28393,   -40, 28354, 28404,    62,-28343,
+     25105,-16371,-30802,  5651, 32766,  5750,-30767,-16459, 25040,
+     21068,-28368,-11242, 32261,    62,-32284, 11121, 28429,-20973,
+     16390,-32766, 16347, 16434,-32766, 16303, 16478,-32766, 16260,
+     11216,-28393, 32261,-21012,   -91, 21144,-32292, 28304,-11053,
+      5701,-16415, 25137,-30819, 32766,-30750, 25007,-16240,  5502,
+    // length 10
+     32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+     32364, 29197, 23174, 14884,  5136, -5115,-14864,-23158,-29187,-32361,
+     31164, 19266,    12,-19248,-31157,-31173,-19288,   -40, 19225, 31148,
+     29197,  5136,-23158,-32368,-14909, 14839, 32356, 23209, -5065,-29164,
+     26512,-10114,-32766,-10162, 26482, 26542,-10066,-32766,-10210, 26453,
+     23174,-23158,-23194, 23138, 23209,-23123,-23229, 23102, 23245,-23087,
+     19266,-31157,   -40, 31179,-19207,-19329, 31133,   113,-31204, 19143,
+     14884,-32368, 23138,  5186,-29233, 29151, -5015,-23265, 32340,-14730,
+     10135,-26529, 32766,-26469, 10039, 10231,-26588, 32766,-26410,  9943,
+      5136,-14909, 23209,-29233, 32379,-32345, 29128,-23051, 14704, -4916
+};
+
+const Word16 idct_tbl[] =
+{
+    // length 1
+     32767,
+    // length 2
+     32767, 23170,
+     32767,-23172,
+    // length 3
+     32767, 28378, 16385,
+     32767,     3,-32766,
+     32767,-28376, 16374,
+    // length 4
+     32767, 30274, 23170, 12540,
+     32767, 12540,-23172,-30275,
+     32767,-12542,-23172, 30274,
+     32767,-30275, 23170,-12542,
+    // length 5
+     32767, 31164, 26512, 19266, 10135,
+     32767, 19266,-10114,-31157,-26529,
+     32767,    12,-32766,   -40, 32766,
+     32767,-19248,-10162, 31179,-26469,
+     32767,-31157, 26482,-19207, 10039,
+    // length 6
+     32767, 31651, 28379, 23174, 16390,  8490,
+     32767, 23174,    12,-23158,-32766,-23194,
+     32767,  8490,-28368,-23194, 16347, 31664,
+     32767, -8469,-28393, 23138, 16434,-31632,
+     32767,-23158,   -40, 23209,-32766, 23102,
+     32767,-31645, 28354,-23123, 16303, -8372,
+    // length 7
+     32767, 31946, 29524, 25622, 20435, 14225,  7302,
+     32767, 25622,  7302,-14205,-29514,-31952,-20457,
+     32767, 14225,-20418,-31952, -7329, 25590, 29545,
+     32767,    12,-32766,   -40, 32766,    62,-32766,
+     32767,-14205,-20457, 31935, -7231,-25670, 29480,
+     32767,-25608,  7253, 14270,-29558, 31923,-20339,
+     32767,-31941, 29502,-25577, 20356,-14114,  7155,
+    // length 8
+     32767, 32138, 30274, 27246, 23170, 18205, 12540,  6393,
+     32767, 27246, 12540, -6396,-23172,-32138,-30275,-18207,
+     32767, 18205,-12542,-32138,-23172,  6393, 30274, 27246,
+     32767,  6393,-30275,-18207, 23170, 27246,-12542,-32138,
+     32767, -6396,-30275, 18205, 23170,-27247,-12542, 32138,
+     32767,-18207,-12542, 32138,-23172, -6396, 30274,-27247,
+     32767,-27247, 12540,  6393,-23172, 32138,-30275, 18205,
+     32767,-32138, 30274,-27247, 23170,-18207, 12540, -6396,
+    // length 9
+     32767, 32270, 30792, 28379, 25105, 21068, 16390, 11216,  5701,
+     32767, 28379, 16390,    12,-16371,-28368,-32766,-28393,-16415,
+     32767, 21068, -5679,-28368,-30802,-11242, 16347, 32261, 25137,
+     32767, 11216,-25091,-28393,  5651, 32261, 16434,-21012,-30819,
+     32767,    12,-32766,   -40, 32766,    62,-32766,   -91, 32766,
+     32767,-11195,-25123, 28354,  5750,-32284, 16303, 21144,-30750,
+     32767,-21051, -5728, 28404,-30767, 11121, 16478,-32292, 25007,
+     32767,-28368, 16347,    62,-16459, 28429,-32766, 28304,-16240,
+     32767,-32266, 30775,-28343, 25040,-20973, 16260,-11053,  5502,
+    // length 10
+     32767, 32364, 31164, 29197, 26512, 23174, 19266, 14884, 10135,  5136,
+     32767, 29197, 19266,  5136,-10114,-23158,-31157,-32368,-26529,-14909,
+     32767, 23174,    12,-23158,-32766,-23194,   -40, 23138, 32766, 23209,
+     32767, 14884,-19248,-32368,-10162, 23138, 31179,  5186,-26469,-29233,
+     32767,  5136,-31157,-14909, 26482, 23209,-19207,-29233, 10039, 32379,
+     32767, -5115,-31173, 14839, 26542,-23123,-19329, 29151, 10231,-32345,
+     32767,-14864,-19288, 32356,-10066,-23229, 31133, -5015,-26588, 29128,
+     32767,-23158,   -40, 23209,-32766, 23102,   113,-23265, 32766,-23051,
+     32767,-29187, 19225, -5065,-10210, 23245,-31204, 32340,-26410, 14704,
+     32767,-32361, 31148,-29164, 26453,-23087, 19143,-14730,  9943, -4916
+};
+
+
+
 //-----------------------------------------------------------------------------
 //
 // Gain Quantizer Levels in signed Q5.11 format
@@ -40,6 +40,15 @@ extern const Word16 bit_allocation_offset_tbl[];
 //-----------------------------------------------------------------------------
 extern const UWord32 lmprbl_tbl[];
 
+//-----------------------------------------------------------------------------
+//
+// DCT/IDCT basis for each block length in Q1.15 format
+//
+//-----------------------------------------------------------------------------
+extern const Word16 dct_tbl_offset[];
+extern const Word16 dct_tbl[];
+extern const Word16 idct_tbl[];
+
 //-----------------------------------------------------------------------------
 //
 // Gain Quantizer Levels in Q5.11 format
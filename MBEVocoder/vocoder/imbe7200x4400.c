@@ -32,6 +32,7 @@
 #include <math.h>
 
 #include "vocoder/mbe.h"
+#include "vocoder/mbe_math.h"
 #include "vocoder/imbe7200x4400_const.h"
 
 #ifdef _MSC_VER
@@ -135,7 +136,7 @@ int mbe_decodeImbe4400Parms(char* imbe_d, mbe_parms* cur_mp, mbe_parms* prev_mp)
     float Sum77, Tl[57], Gm[7], Ri[7], sum, c1, c2;
     const float* ba1, *ba2;
     char tmpstr[13];
-    const int* bo1, *bo2;
+    const int8_t* bo1, *bo2;
     char bb[58][12];
 
     // copy repeat from prev_mp
@@ -275,7 +276,7 @@ int mbe_decodeImbe4400Parms(char* imbe_d, mbe_parms* cur_mp, mbe_parms* prev_mp)
             else {
                 am = 2;
             }
-            sum = sum + ((float)am * Gm[m] * cosf((M_PI * (float)(m - 1) * ((float)i - 0.5)) / (float)6));
+            sum = sum + ((float)am * Gm[m] * mbe_cosf((M_PI * (float)(m - 1) * ((float)i - 0.5)) / (float)6));
 #ifdef IMBE_DEBUG
             fprintf(stderr, "MBE: IMBE: sum: %e ", sum);
 #endif
@@ -324,7 +325,7 @@ int mbe_decodeImbe4400Parms(char* imbe_d, mbe_parms* cur_mp, mbe_parms* prev_mp)
                 else {
                     ak = 2;
                 }
-                sum = sum + ((float)ak * Cik[i][k] * cosf((M_PI * (float)(k - 1) * ((float)j - 0.5)) / (float)ji));
+                sum = sum + ((float)ak * Cik[i][k] * mbe_cosf((M_PI * (float)(k - 1) * ((float)j - 0.5)) / (float)ji));
             }
             Tl[l] = sum;
             l++;
@@ -381,7 +382,7 @@ int mbe_decodeImbe4400Parms(char* imbe_d, mbe_parms* cur_mp, mbe_parms* prev_mp)
         c1 = (rho * ((float)1 - deltal[l]) * prev_mp->log2Ml[intkl[l]]);
         c2 = (rho * deltal[l] * prev_mp->log2Ml[intkl[l] + 1]);
         cur_mp->log2Ml[l] = Tl[l] + c1 + c2 - Sum77;
-        cur_mp->Ml[l] = powf(2, cur_mp->log2Ml[l]);
+        cur_mp->Ml[l] = mbe_exp2f(cur_mp->log2Ml[l]);
 #ifdef IMBE_DEBUG
         fprintf(stderr, "MBE: IMBE: rho: %e c1: %e c2: %e Sum77: %e T%i: %e log2M%i: %e M%i: %e", rho, c1, c2, Sum77, l, Tl[l], l, cur_mp->log2Ml[l], l, cur_mp->Ml[l]);
 #endif
@@ -397,40 +398,29 @@ int mbe_decodeImbe4400Parms(char* imbe_d, mbe_parms* cur_mp, mbe_parms* prev_mp)
 void mbe_demodulateImbe7200x4400Data(char imbe[8][23])
 {
     int i, j, k;
-    unsigned short pr[115];
-    unsigned short foo;
-    char tmpstr[24];
+    const unsigned long long* pr;
+    unsigned short foo = 0;
 
-    // create pseudo-random modulator
-    j = 0;
-    tmpstr[12] = 0;
+    // look up pseudo-random modulator
     for (i = 22; i >= 11; i--) {
-        tmpstr[j] = (imbe[0][i] + 48);
-        j++;
+        foo <<= 1;
+        foo |= imbe[0][i];
     }
 
-    foo = strtol(tmpstr, NULL, 2);
-    pr[0] = (16 * foo);
-    for (i = 1; i < 115; i++) {
-        pr[i] = (173 * pr[i - 1]) + 13849 - (65536 * (((173 * pr[i - 1]) + 13849) / 65536));
-    }
-
-    for (i = 1; i < 115; i++) {
-        pr[i] = pr[i] / 32768;
-    }
+    pr = mbe_imbeWhitening(foo);
 
-    // demodulate imbe with pr
-    k = 1;
+    // demodulate imbe with pr; k counts from pr[1]
+    k = 0;
     for (i = 1; i < 4; i++) {
         for (j = 22; j >= 0; j--) {
-            imbe[i][j] = ((imbe[i][j]) ^ pr[k]);
+            imbe[i][j] = ((imbe[i][j]) ^ ((pr[k >> 6] >> (63 - (k & 63))) & 1));
             k++;
         }
     }
 
     for (i = 4; i < 7; i++) {
         for (j = 14; j >= 0; j--) {
-            imbe[i][j] = ((imbe[i][j]) ^ pr[k]);
+            imbe[i][j] = ((imbe[i][j]) ^ ((pr[k >> 6] >> (63 - (k & 63))) & 1));
             k++;
         }
     }
@@ -469,10 +459,12 @@ void mbe_processImbe4400DataF(float* aout_buf, int* errs, int* errs2, char* err_
     }
 
     if (cur_mp->repeat <= 3) {
-        mbe_moveMbeParms(cur_mp, prev_mp);
-        mbe_spectralAmpEnhance(cur_mp);
-        mbe_synthesizeSpeechf(aout_buf, cur_mp, prev_mp_enhanced, uvquality);
-        mbe_moveMbeParms(cur_mp, prev_mp_enhanced);
+        // a repeated frame is already a copy of prev_mp
+        if (cur_mp->repeat == 0)
+            mbe_moveMbeParms(cur_mp, prev_mp);
+        else
+            prev_mp->repeat = cur_mp->repeat;
+        mbe_synthesizeEnhancedSpeechf(aout_buf, cur_mp, prev_mp_enhanced, uvquality);
     }
     else {
         *err_str = 'M';
@@ -28,16 +28,29 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #define _USE_MATH_DEFINES
 #include <math.h>
 
 #include "vocoder/mbe.h"
 #include "vocoder/mbe_const.h"
+#include "vocoder/mbe_math.h"
 
 #ifdef _MSC_VER
 #pragma warning(disable: 4244)
 #endif
 
+#if defined(_MSC_VER)
+#define MBE_FORCE_INLINE __forceinline
+#else
+#define MBE_FORCE_INLINE inline __attribute__((always_inline))
+#endif
+
+#if (defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)) && !defined(MBE_DEBUG)
+#include <emmintrin.h>
+#define MBE_FLOAT_TO_SHORT_SSE2
+#endif
+
 // ---------------------------------------------------------------------------
 //  Global Functions
 // ---------------------------------------------------------------------------
@@ -61,53 +74,25 @@ static float mbe_rand_phase()
 }
 
 /// <summary>
-/// 
+/// Copies the current frame parameters over the previous frame parameters.
 /// </summary>
 /// <param name="cur_mp"></param>
 /// <param name="prev_mp"></param>
 void mbe_moveMbeParms(mbe_parms* cur_mp, mbe_parms* prev_mp)
 {
-    int l;
-
-    prev_mp->w0 = cur_mp->w0;
-    prev_mp->L = cur_mp->L;
-    prev_mp->K = cur_mp->K;       // necessary?
-    prev_mp->Ml[0] = (float)0;
-    prev_mp->gamma = cur_mp->gamma;
-    prev_mp->repeat = cur_mp->repeat;
-
-    for (l = 0; l <= 56; l++) {
-        prev_mp->Ml[l] = cur_mp->Ml[l];
-        prev_mp->Vl[l] = cur_mp->Vl[l];
-        prev_mp->log2Ml[l] = cur_mp->log2Ml[l];
-        prev_mp->PHIl[l] = cur_mp->PHIl[l];
-        prev_mp->PSIl[l] = cur_mp->PSIl[l];
-    }
+    if (cur_mp != prev_mp)
+        memcpy(prev_mp, cur_mp, sizeof(mbe_parms));
 }
 
 /// <summary>
-/// 
+/// Copies the previous frame parameters over the current frame parameters (frame repeat).
 /// </summary>
 /// <param name="cur_mp"></param>
 /// <param name="prev_mp"></param>
 void mbe_useLastMbeParms(mbe_parms* cur_mp, mbe_parms* prev_mp)
 {
-    int l;
-
-    cur_mp->w0 = prev_mp->w0;
-    cur_mp->L = prev_mp->L;
-    cur_mp->K = prev_mp->K;       // necessary?
-    cur_mp->Ml[0] = (float)0;
-    cur_mp->gamma = prev_mp->gamma;
-    cur_mp->repeat = prev_mp->repeat;
-
-    for (l = 0; l <= 56; l++) {
-        cur_mp->Ml[l] = prev_mp->Ml[l];
-        cur_mp->Vl[l] = prev_mp->Vl[l];
-        cur_mp->log2Ml[l] = prev_mp->log2Ml[l];
-        cur_mp->PHIl[l] = prev_mp->PHIl[l];
-        cur_mp->PSIl[l] = prev_mp->PSIl[l];
-    }
+    if (cur_mp != prev_mp)
+        memcpy(cur_mp, prev_mp, sizeof(mbe_parms));
 }
 
 /// <summary>
@@ -139,54 +124,115 @@ void mbe_initMbeParms(mbe_parms* cur_mp, mbe_parms* prev_mp, mbe_parms* prev_mp_
 }
 
 /// <summary>
-/// 
+/// Converts parameters to the model layout used by the enhancement and synthesis kernels.
 /// </summary>
-/// <param name="cur_mp"></param>
-void mbe_spectralAmpEnhance(mbe_parms* cur_mp)
+/// <param name="mp"></param>
+/// <param name="model"></param>
+void mbe_parmsToModel(const mbe_parms* mp, mbe_model* model)
 {
+    int l;
 
-    float Rm0, Rm1, R2m0, R2m1, Wl[57];
+    model->w0 = mp->w0;
+    model->gamma = mp->gamma;
+    model->L = mp->L;
+    model->K = mp->K;
+    model->un = mp->un;
+    model->repeat = mp->repeat;
+
+    memcpy(model->Ml, mp->Ml + 1, 56 * sizeof(float));
+    memcpy(model->log2Ml, mp->log2Ml + 1, 56 * sizeof(float));
+    memcpy(model->PHIl, mp->PHIl + 1, 56 * sizeof(float));
+    memcpy(model->PSIl, mp->PSIl + 1, 56 * sizeof(float));
+    for (l = 0; l < 56; l++) {
+        model->Vl[l] = (unsigned char)mp->Vl[l + 1];
+    }
+
+    // padding harmonics are silent and never read back
+    memset(model->Ml + 56, 0, (MBE_MODEL_HARMS - 56) * sizeof(float));
+    memset(model->log2Ml + 56, 0, (MBE_MODEL_HARMS - 56) * sizeof(float));
+    memset(model->PHIl + 56, 0, (MBE_MODEL_HARMS - 56) * sizeof(float));
+    memset(model->PSIl + 56, 0, (MBE_MODEL_HARMS - 56) * sizeof(float));
+    memset(model->Vl + 56, 0, MBE_MODEL_HARMS - 56);
+}
+
+/// <summary>
+/// Converts model parameters back to the parameter layout; harmonic 0 of the parameters is left untouched.
+/// </summary>
+/// <param name="model"></param>
+/// <param name="mp"></param>
+void mbe_modelToParms(const mbe_model* model, mbe_parms* mp)
+{
     int l;
-    float sum, gamma, M;
+
+    mp->w0 = model->w0;
+    mp->gamma = model->gamma;
+    mp->L = model->L;
+    mp->K = model->K;
+    mp->un = model->un;
+    mp->repeat = model->repeat;
+
+    memcpy(mp->Ml + 1, model->Ml, 56 * sizeof(float));
+    memcpy(mp->log2Ml + 1, model->log2Ml, 56 * sizeof(float));
+    memcpy(mp->PHIl + 1, model->PHIl, 56 * sizeof(float));
+    memcpy(mp->PSIl + 1, model->PSIl, 56 * sizeof(float));
+    for (l = 0; l < 56; l++) {
+        mp->Vl[l + 1] = model->Vl[l];
+    }
+}
+
+/// <summary>
+/// Applies spectral amplitude enhancement to the given model parameters.
+/// </summary>
+/// <remarks>
+/// The squared amplitudes and the cos(w0 * l) terms are computed once per harmonic into
+/// aligned arrays; the sums keep the harmonic order, so the result matches the per-harmonic form.
+/// </remarks>
+/// <param name="cur"></param>
+void mbe_spectralAmpEnhanceModel(mbe_model* cur)
+{
+    MBE_ALIGN(16) float Ml2[MBE_MODEL_HARMS];
+    MBE_ALIGN(16) float cosl[MBE_MODEL_HARMS];
+    float Rm0, Rm1, R2m0, R2m1, Wl;
+    int i, L;
+    float sum, gamma;
+
+    L = cur->L;
+    for (i = 0; i < L; i++) {
+        Ml2[i] = cur->Ml[i] * cur->Ml[i];
+        cosl[i] = mbe_cosf(cur->w0 * (float)(i + 1));
+    }
 
     Rm0 = 0;
     Rm1 = 0;
-    for (l = 1; l <= cur_mp->L; l++) {
-        Rm0 = Rm0 + (cur_mp->Ml[l] * cur_mp->Ml[l]);
-        Rm1 = Rm1 + ((cur_mp->Ml[l] * cur_mp->Ml[l]) * cosf(cur_mp->w0 * (float)l));
+    for (i = 0; i < L; i++) {
+        Rm0 = Rm0 + Ml2[i];
+        Rm1 = Rm1 + (Ml2[i] * cosl[i]);
     }
 
     R2m0 = (Rm0 * Rm0);
     R2m1 = (Rm1 * Rm1);
 
-    for (l = 1; l <= cur_mp->L; l++) {
-        if (cur_mp->Ml[l] != 0) {
-            Wl[l] = sqrtf(cur_mp->Ml[l]) * powf((((float)0.96 * M_PI * ((R2m0 + R2m1) - ((float)2 * Rm0 * Rm1 * cosf(cur_mp->w0 * (float)l)))) / (cur_mp->w0 * Rm0 * (R2m0 - R2m1))), (float)0.25);
+    // harmonics with (8 * l) <= L are left as they are
+    for (i = L / 8; i < L; i++) {
+        if (cur->Ml[i] != 0) {
+            Wl = sqrtf(cur->Ml[i]) * mbe_pow025f(((float)0.96 * M_PI * ((R2m0 + R2m1) - ((float)2 * Rm0 * Rm1 * cosl[i]))) / (cur->w0 * Rm0 * (R2m0 - R2m1)));
 
-            if ((8 * l) <= cur_mp->L) {
-                // ?
-            }
-            else if (Wl[l] > 1.2) {
-                cur_mp->Ml[l] = 1.2 * cur_mp->Ml[l];
+            if (Wl > 1.2) {
+                cur->Ml[i] = 1.2 * cur->Ml[i];
             }
-            else if (Wl[l] < 0.5) {
-                cur_mp->Ml[l] = 0.5 * cur_mp->Ml[l];
+            else if (Wl < 0.5) {
+                cur->Ml[i] = 0.5 * cur->Ml[i];
             }
             else {
-                cur_mp->Ml[l] = Wl[l] * cur_mp->Ml[l];
+                cur->Ml[i] = Wl * cur->Ml[i];
             }
         }
     }
 
     // generate scaling factor
     sum = 0;
-    for (l = 1; l <= cur_mp->L; l++) {
-        M = cur_mp->Ml[l];
-        if (M < 0) {
-            M = -M;
-        }
-
-        sum += (M * M);
+    for (i = 0; i < L; i++) {
+        sum += (cur->Ml[i] * cur->Ml[i]);
     }
 
     if (sum == 0) {
@@ -197,11 +243,24 @@ void mbe_spectralAmpEnhance(mbe_parms* cur_mp)
     }
 
     // apply scaling factor
-    for (l = 1; l <= cur_mp->L; l++) {
-        cur_mp->Ml[l] = gamma * cur_mp->Ml[l];
+    for (i = 0; i < L; i++) {
+        cur->Ml[i] = gamma * cur->Ml[i];
     }
 }
 
+/// <summary>
+/// 
+/// </summary>
+/// <param name="cur_mp"></param>
+void mbe_spectralAmpEnhance(mbe_parms* cur_mp)
+{
+    mbe_model cur;
+
+    mbe_parmsToModel(cur_mp, &cur);
+    mbe_spectralAmpEnhanceModel(&cur);
+    mbe_modelToParms(&cur, cur_mp);
+}
+
 /// <summary>
 /// 
 /// </summary>
@@ -235,25 +294,127 @@ void mbe_synthesizeSilence(short* aout_buf)
 }
 
 /// <summary>
-/// 
+/// Computes the multisine frequency multipliers of harmonic l for the unvoiced mix.
 /// </summary>
-/// <param name="aout_buf"></param>
-/// <param name="cur_mp"></param>
-/// <param name="prev_mp"></param>
+/// <param name="freq"></param>
+/// <param name="l"></param>
 /// <param name="uvquality"></param>
-void mbe_synthesizeSpeechf(float* aout_buf, mbe_parms* cur_mp, mbe_parms* prev_mp, int uvquality)
+/// <param name="uvstep"></param>
+/// <param name="uvoffset"></param>
+static MBE_FORCE_INLINE void mbe_unvoicedFreqs(float* freq, int l, const int uvquality, float uvstep, float uvoffset)
 {
+    int i;
 
-    int i, l, n, maxl;
-    float* Ss, loguvquality;
-    float C1, C2, C3, C4;
-    //float deltaphil, deltawl, thetaln, aln;
+    for (i = 0; i < uvquality; i++) {
+        freq[i] = (float)l + ((float)i * uvstep) - uvoffset;
+    }
+}
+
+/// <summary>
+/// Unvoiced multisine mix for one sample; noise is a constant at every call site so the
+/// branch is resolved outside of the per-sample loop.
+/// </summary>
+/// <param name="w0n"></param>
+/// <param name="freq"></param>
+/// <param name="rphase"></param>
+/// <param name="uvquality"></param>
+/// <param name="noise"></param>
+/// <param name="noiseAmp"></param>
+/// <returns></returns>
+static MBE_FORCE_INLINE float mbe_unvoicedMix(float w0n, const float* freq, const float* rphase, const int uvquality, const int noise, float noiseAmp)
+{
+    int i;
+    float C = 0;
+
+    for (i = 0; i < uvquality; i++) {
+        C = C + mbe_cosf((w0n * freq[i]) + rphase[i]);
+        if (noise) {
+            C = C + (noiseAmp * mbe_rand());
+        }
+    }
+
+    return C;
+}
+
+/// <summary>
+/// Synthesizes harmonic l going from voiced to unvoiced (eq 131 and the unvoiced mix).
+/// </summary>
+static MBE_FORCE_INLINE void mbe_synthesizeVoicedToUnvoiced(float* aout_buf, const mbe_model* cur, const mbe_model* prev, int l, const float* freq, const float* rphase,
+    const int uvquality, float uvsine, float qfactor, const int noise, float noiseAmp)
+{
+    const int N = 160;
+    int n;
+    float C1, C3;
+    float cw0 = cur->w0;
+    float pw0l = (prev->w0 * (float)l);
+
+    for (n = 0; n < N; n++) {
+        C1 = Ws[n + N] * prev->Ml[l - 1] * mbe_cosf((pw0l * (float)n) + prev->PHIl[l - 1]);
+        C3 = mbe_unvoicedMix(cw0 * (float)n, freq, rphase, uvquality, noise, noiseAmp);
+        C3 = C3 * uvsine * Ws[n] * cur->Ml[l - 1] * qfactor;
+        aout_buf[n] = aout_buf[n] + C1 + C3;
+    }
+}
+
+/// <summary>
+/// Synthesizes harmonic l going from unvoiced to voiced (eq 132 and the unvoiced mix).
+/// </summary>
+static MBE_FORCE_INLINE void mbe_synthesizeUnvoicedToVoiced(float* aout_buf, const mbe_model* cur, const mbe_model* prev, int l, const float* freq, const float* rphase,
+    const int uvquality, float uvsine, float qfactor, const int noise, float noiseAmp)
+{
+    const int N = 160;
+    int n;
+    float C1, C3;
+    float pw0 = prev->w0;
+    float cw0l = (cur->w0 * (float)l);
+
+    for (n = 0; n < N; n++) {
+        C1 = Ws[n] * cur->Ml[l - 1] * mbe_cosf((cw0l * (float)(n - N)) + cur->PHIl[l - 1]);
+        C3 = mbe_unvoicedMix(pw0 * (float)n, freq, rphase, uvquality, noise, noiseAmp);
+        C3 = C3 * uvsine * Ws[n + N] * prev->Ml[l - 1] * qfactor;
+        aout_buf[n] = aout_buf[n] + C1 + C3;
+    }
+}
+
+/// <summary>
+/// Synthesizes harmonic l unvoiced in both frames.
+/// </summary>
+static MBE_FORCE_INLINE void mbe_synthesizeUnvoiced(float* aout_buf, const mbe_model* cur, const mbe_model* prev, int l, const float* freq, const float* rphase, const float* rphase2,
+    const int uvquality, float uvsine, float qfactor, const int pnoise, float pnoiseAmp, const int cnoise, float cnoiseAmp)
+{
+    const int N = 160;
+    int n;
+    float C3, C4;
+    float pw0 = prev->w0;
+    float cw0 = cur->w0;
+
+    for (n = 0; n < N; n++) {
+        C3 = mbe_unvoicedMix(pw0 * (float)n, freq, rphase, uvquality, pnoise, pnoiseAmp);
+        C3 = C3 * uvsine * Ws[n + N] * prev->Ml[l - 1] * qfactor;
+        C4 = mbe_unvoicedMix(cw0 * (float)n, freq, rphase2, uvquality, cnoise, cnoiseAmp);
+        C4 = C4 * uvsine * Ws[n] * cur->Ml[l - 1] * qfactor;
+        aout_buf[n] = aout_buf[n] + C3 + C4;
+    }
+}
+
+/// <summary>
+/// Speech synthesis kernel; uvquality is a constant in each specialized instance, so the
+/// unvoiced step, offset and scaling fold and the multisine loops can be unrolled.
+/// </summary>
+/// <param name="aout_buf"></param>
+/// <param name="cur"></param>
+/// <param name="prev"></param>
+/// <param name="uvquality"></param>
+static MBE_FORCE_INLINE void mbe_synthesizeSpeechKernel(float* aout_buf, mbe_model* cur, mbe_model* prev, const int uvquality)
+{
+    int i, l, n, maxl, lowl;
+    float loguvquality;
     int numUv;
-    float cw0, pw0, cw0l, pw0l;
+    float cw0, pw0, sw0, cw0l, pw0l;
     float uvsine, uvrand, uvthreshold, uvthresholdf;
     float uvstep, uvoffset;
     float qfactor;
-    float rphase[64], rphase2[64];
+    float rphase[64], rphase2[64], freq[64];
 
     const int N = 160;
 
@@ -264,11 +425,6 @@ void mbe_synthesizeSpeechf(float* aout_buf, mbe_parms* cur_mp, mbe_parms* prev_m
     uvsine = (float)1.3591409 * M_E;
     uvrand = (float)2.0;
 
-    if ((uvquality < 1) || (uvquality > 64)) {
-        fprintf(stderr, "MBE: Error - uvquality must be within the range 1 - 64, setting to default value of 3");
-        uvquality = 3;
-    }
-
     // calculate loguvquality
     if (uvquality == 1) {
         loguvquality = (float)1 / M_E;
@@ -284,141 +440,85 @@ void mbe_synthesizeSpeechf(float* aout_buf, mbe_parms* cur_mp, mbe_parms* prev_m
 
     // count number of unvoiced bands
     numUv = 0;
-    for (l = 1; l <= cur_mp->L; l++) {
-        if (cur_mp->Vl[l] == 0) {
-            numUv++;
-        }
+    for (i = 0; i < cur->L; i++) {
+        numUv += (cur->Vl[i] == 0);
     }
 
-    cw0 = cur_mp->w0;
-    pw0 = prev_mp->w0;
+    cw0 = cur->w0;
+    pw0 = prev->w0;
 
     // init aout_buf
-    Ss = aout_buf;
     for (n = 0; n < N; n++) {
-        *Ss = (float)0;
-        Ss++;
+        aout_buf[n] = (float)0;
     }
 
     // eq 128 and 129
-    if (cur_mp->L > prev_mp->L) {
-        maxl = cur_mp->L;
-        for (l = prev_mp->L + 1; l <= maxl; l++) {
-            prev_mp->Ml[l] = (float)0;
-            prev_mp->Vl[l] = 1;
-        }
+    if (cur->L > prev->L) {
+        maxl = cur->L;
+        memset(prev->Ml + prev->L, 0, (maxl - prev->L) * sizeof(float));
+        memset(prev->Vl + prev->L, 1, maxl - prev->L);
     }
     else {
-        maxl = prev_mp->L;
-        for (l = cur_mp->L + 1; l <= maxl; l++) {
-            cur_mp->Ml[l] = (float)0;
-            cur_mp->Vl[l] = 1;
-        }
+        maxl = prev->L;
+        memset(cur->Ml + cur->L, 0, (maxl - cur->L) * sizeof(float));
+        memset(cur->Vl + cur->L, 1, maxl - cur->L);
     }
 
-    // update PHIl from eq 139,140
-    for (l = 1; l <= 56; l++) {
-        cur_mp->PSIl[l] = prev_mp->PSIl[l] + ((pw0 + cw0) * ((float)(l * N) / (float)2));
-        if (l <= (int)(cur_mp->L / 4)) {
-            cur_mp->PHIl[l] = cur_mp->PSIl[l];
-        }
-        else {
-            cur_mp->PHIl[l] = cur_mp->PSIl[l] + ((numUv * mbe_rand_phase()) / cur_mp->L);
-        }
+    // update PSIl from eq 139; an elementwise pass over the aligned arrays
+    sw0 = pw0 + cw0;
+    for (i = 0; i < 56; i++) {
+        cur->PSIl[i] = prev->PSIl[i] + (sw0 * ((float)((i + 1) * N) / (float)2));
+    }
+
+    // update PHIl from eq 140; the random phases are drawn in harmonic order
+    lowl = (int)(cur->L / 4);
+    memcpy(cur->PHIl, cur->PSIl, lowl * sizeof(float));
+    for (i = lowl; i < 56; i++) {
+        cur->PHIl[i] = cur->PSIl[i] + ((numUv * mbe_rand_phase()) / cur->L);
     }
 
     for (l = 1; l <= maxl; l++) {
         cw0l = (cw0 * (float)l);
         pw0l = (pw0 * (float)l);
-        if ((cur_mp->Vl[l] == 0) && (prev_mp->Vl[l] == 1)) {
-            Ss = aout_buf;
+        if ((cur->Vl[l - 1] == 0) && (prev->Vl[l - 1] == 1)) {
             // init random phase
             for (i = 0; i < uvquality; i++) {
                 rphase[i] = mbe_rand_phase();
             }
 
-            for (n = 0; n < N; n++) {
-                C1 = 0;
-                // eq 131
-                C1 = Ws[n + N] * prev_mp->Ml[l] * cosf((pw0l * (float)n) + prev_mp->PHIl[l]);
-                C3 = 0;
-
-                // unvoiced multisine mix
-                for (i = 0; i < uvquality; i++)
-                {
-                    C3 = C3 + cosf((cw0 * (float)n * ((float)l + ((float)i * uvstep) - uvoffset)) + rphase[i]);
-                    if (cw0l > uvthreshold)
-                    {
-                        C3 = C3 + ((cw0l - uvthreshold) * uvrand * mbe_rand());
-                    }
-                }
-                C3 = C3 * uvsine * Ws[n] * cur_mp->Ml[l] * qfactor;
-                *Ss = *Ss + C1 + C3;
-                Ss++;
+            mbe_unvoicedFreqs(freq, l, uvquality, uvstep, uvoffset);
+            if (cw0l > uvthreshold) {
+                mbe_synthesizeVoicedToUnvoiced(aout_buf, cur, prev, l, freq, rphase, uvquality, uvsine, qfactor, 1, (cw0l - uvthreshold) * uvrand);
+            }
+            else {
+                mbe_synthesizeVoicedToUnvoiced(aout_buf, cur, prev, l, freq, rphase, uvquality, uvsine, qfactor, 0, (float)0);
             }
         }
-        else if ((cur_mp->Vl[l] == 1) && (prev_mp->Vl[l] == 0)) {
-            Ss = aout_buf;
+        else if ((cur->Vl[l - 1] == 1) && (prev->Vl[l - 1] == 0)) {
             // init random phase
             for (i = 0; i < uvquality; i++) {
                 rphase[i] = mbe_rand_phase();
             }
-            
-            for (n = 0; n < N; n++) {
-                C1 = 0;
-                // eq 132
-                C1 = Ws[n] * cur_mp->Ml[l] * cosf((cw0l * (float)(n - N)) + cur_mp->PHIl[l]);
-                C3 = 0;
-
-                // unvoiced multisine mix
-                for (i = 0; i < uvquality; i++) {
-                    C3 = C3 + cosf((pw0 * (float)n * ((float)l + ((float)i * uvstep) - uvoffset)) + rphase[i]);
-                    if (pw0l > uvthreshold) {
-                        C3 = C3 + ((pw0l - uvthreshold) * uvrand * mbe_rand());
-                    }
-                }
-                C3 = C3 * uvsine * Ws[n + N] * prev_mp->Ml[l] * qfactor;
-                *Ss = *Ss + C1 + C3;
-                Ss++;
+
+            mbe_unvoicedFreqs(freq, l, uvquality, uvstep, uvoffset);
+            if (pw0l > uvthreshold) {
+                mbe_synthesizeUnvoicedToVoiced(aout_buf, cur, prev, l, freq, rphase, uvquality, uvsine, qfactor, 1, (pw0l - uvthreshold) * uvrand);
+            }
+            else {
+                mbe_synthesizeUnvoicedToVoiced(aout_buf, cur, prev, l, freq, rphase, uvquality, uvsine, qfactor, 0, (float)0);
             }
         }
-        //      else if (((cur_mp->Vl[l] == 1) || (prev_mp->Vl[l] == 1)) && ((l >= 8) || (fabsf (cw0 - pw0) >= ((float) 0.1 * cw0))))
-        else if ((cur_mp->Vl[l] == 1) || (prev_mp->Vl[l] == 1)) {
-            Ss = aout_buf;
+        else if ((cur->Vl[l - 1] == 1) || (prev->Vl[l - 1] == 1)) {
+            float C1, C2;
             for (n = 0; n < N; n++) {
-                C1 = 0;
                 // eq 133-1
-                C1 = Ws[n + N] * prev_mp->Ml[l] * cosf((pw0l * (float)n) + prev_mp->PHIl[l]);
-                C2 = 0;
+                C1 = Ws[n + N] * prev->Ml[l - 1] * mbe_cosf((pw0l * (float)n) + prev->PHIl[l - 1]);
                 // eq 133-2
-                C2 = Ws[n] * cur_mp->Ml[l] * cosf((cw0l * (float)(n - N)) + cur_mp->PHIl[l]);
-                *Ss = *Ss + C1 + C2;
-                Ss++;
+                C2 = Ws[n] * cur->Ml[l - 1] * mbe_cosf((cw0l * (float)(n - N)) + cur->PHIl[l - 1]);
+                aout_buf[n] = aout_buf[n] + C1 + C2;
             }
         }
-/*
-        // expensive and unnecessary?
-        else if ((cur_mp->Vl[l] == 1) || (prev_mp->Vl[l] == 1)) {
-            Ss = aout_buf;
-            // eq 137
-            deltaphil = cur_mp->PHIl[l] - prev_mp->PHIl[l] - (((pw0 + cw0) * (float) (l * N)) / (float) 2);
-            // eq 138
-            deltawl = ((float) 1 / (float) N) * (deltaphil - ((float) 2 * M_PI * (int) ((deltaphil + M_PI) / (M_PI * (float) 2))));
-                  
-            for (n = 0; n < N; n++) {
-                // eq 136
-                thetaln = prev_mp->PHIl[l] + ((pw0l + deltawl) * (float) n) + (((cw0 - pw0) * ((float) (l * n * n)) / (float) (2 * N)));
-                // eq 135
-                aln = prev_mp->Ml[l] + (((float) n / (float) N) * (cur_mp->Ml[l] - prev_mp->Ml[l]));
-                // eq 134
-                *Ss = *Ss + (aln * cosf (thetaln));
-                Ss++;
-            }
-        }
-*/
-        else
-        {
-            Ss = aout_buf;
+        else {
             // init random phase
             for (i = 0; i < uvquality; i++) {
                 rphase[i] = mbe_rand_phase();
@@ -429,36 +529,147 @@ void mbe_synthesizeSpeechf(float* aout_buf, mbe_parms* cur_mp, mbe_parms* prev_m
                 rphase2[i] = mbe_rand_phase();
             }
 
-            for (n = 0; n < N; n++) {
-                C3 = 0;
-
-                // unvoiced multisine mix
-                for (i = 0; i < uvquality; i++) {
-                    C3 = C3 + cosf((pw0 * (float)n * ((float)l + ((float)i * uvstep) - uvoffset)) + rphase[i]);
-                    if (pw0l > uvthreshold) {
-                        C3 = C3 + ((pw0l - uvthreshold) * uvrand * mbe_rand());
-                    }
+            mbe_unvoicedFreqs(freq, l, uvquality, uvstep, uvoffset);
+            if (pw0l > uvthreshold) {
+                if (cw0l > uvthreshold) {
+                    mbe_synthesizeUnvoiced(aout_buf, cur, prev, l, freq, rphase, rphase2, uvquality, uvsine, qfactor, 1, (pw0l - uvthreshold) * uvrand, 1, (cw0l - uvthreshold) * uvrand);
                 }
-
-                C3 = C3 * uvsine * Ws[n + N] * prev_mp->Ml[l] * qfactor;
-                C4 = 0;
-                
-                // unvoiced multisine mix
-                for (i = 0; i < uvquality; i++) {
-                    C4 = C4 + cosf((cw0 * (float)n * ((float)l + ((float)i * uvstep) - uvoffset)) + rphase2[i]);
-                    if (cw0l > uvthreshold) {
-                        C4 = C4 + ((cw0l - uvthreshold) * uvrand * mbe_rand());
-                    }
+                else {
+                    mbe_synthesizeUnvoiced(aout_buf, cur, prev, l, freq, rphase, rphase2, uvquality, uvsine, qfactor, 1, (pw0l - uvthreshold) * uvrand, 0, (float)0);
+                }
+            }
+            else {
+                if (cw0l > uvthreshold) {
+                    mbe_synthesizeUnvoiced(aout_buf, cur, prev, l, freq, rphase, rphase2, uvquality, uvsine, qfactor, 0, (float)0, 1, (cw0l - uvthreshold) * uvrand);
+                }
+                else {
+                    mbe_synthesizeUnvoiced(aout_buf, cur, prev, l, freq, rphase, rphase2, uvquality, uvsine, qfactor, 0, (float)0, 0, (float)0);
                 }
-
-                C4 = C4 * uvsine * Ws[n] * cur_mp->Ml[l] * qfactor;
-                *Ss = *Ss + C3 + C4;
-                Ss++;
             }
         }
     }
 }
 
+/// <summary>
+/// Synthesizes a frame of speech with 1 unvoiced multisine component per harmonic.
+/// </summary>
+/// <param name="aout_buf"></param>
+/// <param name="cur"></param>
+/// <param name="prev"></param>
+static void mbe_synthesizeSpeechUv1(float* aout_buf, mbe_model* cur, mbe_model* prev)
+{
+    mbe_synthesizeSpeechKernel(aout_buf, cur, prev, 1);
+}
+
+/// <summary>
+/// Synthesizes a frame of speech with 3 unvoiced multisine components per harmonic.
+/// </summary>
+/// <param name="aout_buf"></param>
+/// <param name="cur"></param>
+/// <param name="prev"></param>
+static void mbe_synthesizeSpeechUv3(float* aout_buf, mbe_model* cur, mbe_model* prev)
+{
+    mbe_synthesizeSpeechKernel(aout_buf, cur, prev, 3);
+}
+
+/// <summary>
+/// Synthesizes a frame of speech with 8 unvoiced multisine components per harmonic.
+/// </summary>
+/// <param name="aout_buf"></param>
+/// <param name="cur"></param>
+/// <param name="prev"></param>
+static void mbe_synthesizeSpeechUv8(float* aout_buf, mbe_model* cur, mbe_model* prev)
+{
+    mbe_synthesizeSpeechKernel(aout_buf, cur, prev, 8);
+}
+
+/// <summary>
+/// Synthesizes a frame of speech with 16 unvoiced multisine components per harmonic.
+/// </summary>
+/// <param name="aout_buf"></param>
+/// <param name="cur"></param>
+/// <param name="prev"></param>
+static void mbe_synthesizeSpeechUv16(float* aout_buf, mbe_model* cur, mbe_model* prev)
+{
+    mbe_synthesizeSpeechKernel(aout_buf, cur, prev, 16);
+}
+
+typedef void (*mbe_synthesizeSpeechFn)(float* aout_buf, mbe_model* cur, mbe_model* prev);
+
+// specialized synthesis kernels by uvquality; other values run the kernel with uvquality unfolded
+static const mbe_synthesizeSpeechFn mbe_synthesizeSpeechKernels[17] = {
+    NULL, mbe_synthesizeSpeechUv1, NULL, mbe_synthesizeSpeechUv3,
+    NULL, NULL, NULL, NULL,
+    mbe_synthesizeSpeechUv8, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    mbe_synthesizeSpeechUv16
+};
+
+/// <summary>
+/// Synthesizes a frame of speech from the current and previous model parameters.
+/// </summary>
+/// <param name="aout_buf"></param>
+/// <param name="cur"></param>
+/// <param name="prev"></param>
+/// <param name="uvquality"></param>
+void mbe_synthesizeSpeechModelF(float* aout_buf, mbe_model* cur, mbe_model* prev, int uvquality)
+{
+    if ((uvquality < 1) || (uvquality > 64)) {
+        fprintf(stderr, "MBE: Error - uvquality must be within the range 1 - 64, setting to default value of 3");
+        uvquality = 3;
+    }
+
+    if ((uvquality < 17) && (mbe_synthesizeSpeechKernels[uvquality] != NULL)) {
+        mbe_synthesizeSpeechKernels[uvquality](aout_buf, cur, prev);
+    }
+    else {
+        mbe_synthesizeSpeechKernel(aout_buf, cur, prev, uvquality);
+    }
+}
+
+/// <summary>
+/// 
+/// </summary>
+/// <param name="aout_buf"></param>
+/// <param name="cur_mp"></param>
+/// <param name="prev_mp"></param>
+/// <param name="uvquality"></param>
+void mbe_synthesizeSpeechf(float* aout_buf, mbe_parms* cur_mp, mbe_parms* prev_mp, int uvquality)
+{
+    mbe_model cur, prev;
+
+    mbe_parmsToModel(cur_mp, &cur);
+    mbe_parmsToModel(prev_mp, &prev);
+    mbe_synthesizeSpeechModelF(aout_buf, &cur, &prev, uvquality);
+    mbe_modelToParms(&cur, cur_mp);
+    mbe_modelToParms(&prev, prev_mp);
+}
+
+/// <summary>
+/// Enhances the current parameters, synthesizes speech from them and makes them the previous
+/// enhanced parameters.
+/// </summary>
+/// <remarks>
+/// Each parameter set is converted to the model layout once; enhancement and synthesis both
+/// run on the model, and the previous enhanced parameters are not written back as they are
+/// replaced by the current ones.
+/// </remarks>
+/// <param name="aout_buf"></param>
+/// <param name="cur_mp"></param>
+/// <param name="prev_mp_enhanced"></param>
+/// <param name="uvquality"></param>
+void mbe_synthesizeEnhancedSpeechf(float* aout_buf, mbe_parms* cur_mp, mbe_parms* prev_mp_enhanced, int uvquality)
+{
+    mbe_model cur, prev;
+
+    mbe_parmsToModel(cur_mp, &cur);
+    mbe_parmsToModel(prev_mp_enhanced, &prev);
+    mbe_spectralAmpEnhanceModel(&cur);
+    mbe_synthesizeSpeechModelF(aout_buf, &cur, &prev, uvquality);
+    mbe_modelToParms(&cur, cur_mp);
+    mbe_moveMbeParms(cur_mp, prev_mp_enhanced);
+}
+
 /// <summary>
 /// 
 /// </summary>
@@ -484,30 +695,51 @@ void mbe_floatToShort(float* float_buf, short* aout_buf)
     short* aout_buf_p;
     float* float_buf_p;
     int i, again;
-    float audio;
 
     again = 7;
     aout_buf_p = aout_buf;
     float_buf_p = float_buf;
-    for (i = 0; i < 160; i++)
+#if defined(MBE_FLOAT_TO_SHORT_SSE2)
     {
-        audio = again * *float_buf_p;
-        if (audio > 32760)
+        /* the clipped samples are in range, so the saturating pack only narrows them */
+        const __m128 vGain = _mm_set1_ps((float)again);
+        const __m128 vClip = _mm_set1_ps(32760.0f);
+        const __m128 vClipNeg = _mm_set1_ps(-32760.0f);
+        for (i = 0; i < 160; i += 8)
         {
-#ifdef MBE_DEBUG
-            fprintf(stderr, "MBE: audio clip : % f", audio);
-#endif
-            audio = 32760;
+            __m128 smp0 = _mm_mul_ps(vGain, _mm_loadu_ps(float_buf_p));
+            __m128 smp1 = _mm_mul_ps(vGain, _mm_loadu_ps(float_buf_p + 4));
+            smp0 = _mm_max_ps(_mm_min_ps(smp0, vClip), vClipNeg);
+            smp1 = _mm_max_ps(_mm_min_ps(smp1, vClip), vClipNeg);
+            _mm_storeu_si128((__m128i*)aout_buf_p, _mm_packs_epi32(_mm_cvttps_epi32(smp0), _mm_cvttps_epi32(smp1)));
+            aout_buf_p += 8;
+            float_buf_p += 8;
         }
-        else if (audio < -32760)
+    }
+#else
+    {
+        float audio;
+        for (i = 0; i < 160; i++)
         {
+            audio = again * *float_buf_p;
+            if (audio > 32760)
+            {
 #ifdef MBE_DEBUG
-            fprintf(stderr, "MBE: audio clip : % f", audio);
+                fprintf(stderr, "MBE: audio clip : % f", audio);
 #endif
-            audio = -32760;
+                audio = 32760;
+            }
+            else if (audio < -32760)
+            {
+#ifdef MBE_DEBUG
+                fprintf(stderr, "MBE: audio clip : % f", audio);
+#endif
+                audio = -32760;
+            }
+            *aout_buf_p = (short)(audio);
+            aout_buf_p++;
+            float_buf_p++;
         }
-        *aout_buf_p = (short)(audio);
-        aout_buf_p++;
-        float_buf_p++;
     }
+#endif
 }
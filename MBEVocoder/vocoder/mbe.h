@@ -58,6 +58,38 @@ struct mbe_parameters
 
 typedef struct mbe_parameters mbe_parms;
 
+#if defined(_MSC_VER)
+#define MBE_ALIGN(n) __declspec(align(n))
+#else
+#define MBE_ALIGN(n) __attribute__((aligned(n)))
+#endif
+
+#define MBE_MODEL_HARMS 64
+
+// ---------------------------------------------------------------------------
+//  Structure Declaration
+//      Model parameters in the layout used by the enhancement and synthesis
+//      kernels; per-harmonic arrays are padded to 64 entries and harmonic l
+//      is stored at index l - 1, so harmonic 1 starts on a cache line.
+// ---------------------------------------------------------------------------
+
+struct MBE_ALIGN(64) mbe_model_parameters
+{
+    float Ml[MBE_MODEL_HARMS];
+    float log2Ml[MBE_MODEL_HARMS];
+    float PHIl[MBE_MODEL_HARMS];
+    float PSIl[MBE_MODEL_HARMS];
+    unsigned char Vl[MBE_MODEL_HARMS];
+    float w0;
+    float gamma;
+    int L;
+    int K;
+    int un;
+    int repeat;
+};
+
+typedef struct mbe_model_parameters mbe_model;
+
 // ---------------------------------------------------------------------------
 //  Structure Declaration
 //      
@@ -87,6 +119,20 @@ int mbe_hamming1511(char* in, char* out);
 /// <summary></summary>
 int mbe_7100x4400Hamming1511(char* in, char* out);
 
+/*
+** Prototypes from edac/Golay24128.cpp
+*/
+/// <summary></summary>
+unsigned int mbe_golayDecode23127(unsigned int code);
+
+/*
+** Prototypes from edac/AMBEFEC.cpp
+*/
+/// <summary></summary>
+unsigned int mbe_ambeWhitening(int seed);
+/// <summary></summary>
+const unsigned long long* mbe_imbeWhitening(int seed);
+
 /*
 ** Prototypes from ambe3600x2400.c
 */
@@ -165,14 +211,24 @@ void mbe_useLastMbeParms(mbe_parms* cur_mp, mbe_parms* prev_mp);
 /// <summary></summary>
 void mbe_initMbeParms(mbe_parms* cur_mp, mbe_parms* prev_mp, mbe_parms* prev_mp_enhanced);
 /// <summary></summary>
+void mbe_parmsToModel(const mbe_parms* mp, mbe_model* model);
+/// <summary></summary>
+void mbe_modelToParms(const mbe_model* model, mbe_parms* mp);
+/// <summary></summary>
+void mbe_spectralAmpEnhanceModel(mbe_model* cur);
+/// <summary></summary>
 void mbe_spectralAmpEnhance(mbe_parms* cur_mp);
 /// <summary></summary>
 void mbe_synthesizeSilenceF(float* aout_buf);
 /// <summary></summary>
 void mbe_synthesizeSilence(short* aout_buf);
 /// <summary></summary>
+void mbe_synthesizeSpeechModelF(float* aout_buf, mbe_model* cur, mbe_model* prev, int uvquality);
+/// <summary></summary>
 void mbe_synthesizeSpeechf(float* aout_buf, mbe_parms* cur_mp, mbe_parms* prev_mp, int uvquality);
 /// <summary></summary>
+void mbe_synthesizeEnhancedSpeechf(float* aout_buf, mbe_parms* cur_mp, mbe_parms* prev_mp_enhanced, int uvquality);
+/// <summary></summary>
 void mbe_synthesizeSpeech(short* aout_buf, mbe_parms* cur_mp, mbe_parms* prev_mp, int uvquality);
 /// <summary></summary>
 void mbe_floatToShort(float* float_buf, short* aout_buf);
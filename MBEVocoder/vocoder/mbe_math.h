@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/**
+* Digital Voice Modem - MBE Vocoder
+* GPLv2 Open Source. Use is subject to license terms.
+* DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+*
+* @package DVM / MBE Vocoder
+* @license GPLv2 License (https://opensource.org/licenses/GPL-2.0)
+*
+*/
+#if !defined(__MBE_MATH_H__)
+#define __MBE_MATH_H__
+
+#include <string.h>
+#include <math.h>
+
+// ---------------------------------------------------------------------------
+//  Float vocoder math.
+//
+//      By default every function here is the libm call it replaces (with the
+//      same argument promotion), so the float vocoder paths are bit-exact.
+//      Define MBE_FAST_MATH at build time to switch to the branch-free
+//      polynomial approximations below; maximum errors over the ranges the
+//      vocoder uses are:
+//
+//          mbe_cosf / mbe_sinf     3e-7 absolute (|x| < 2^22)
+//          mbe_log2f               6e-7 absolute (normal x > 0)
+//          mbe_exp2f               3e-7 relative (result clamped to 2^-126 .. 2^127)
+//          mbe_expf                4e-6 relative (|x| < 64, dominated by rounding x * log2(e))
+//          mbe_pow025f             1e-7 relative (x >= 0)
+//          mbe_rsqrtf              5e-6 relative (normal x > 0)
+// ---------------------------------------------------------------------------
+
+#if defined(_MSC_VER) && !defined(__cplusplus)
+#define MBE_MATH_INLINE static __inline
+#else
+#define MBE_MATH_INLINE static inline
+#endif
+
+// the rounding shifts below rely on strict float evaluation, so do not build with /fp:fast or
+// -ffast-math; GCC and Clang only vectorize the selects with -fno-trapping-math
+
+#if defined(MBE_FAST_MATH)
+
+#define MBE_MATH_INV_2PI    0.15915494309189535
+#define MBE_MATH_2PI        6.283185307179586f
+#define MBE_MATH_LOG2E      1.442695040888963f
+#define MBE_MATH_LN2        0.693147180559945f
+
+/// <summary>Reinterprets the bits of a float as an integer.</summary>
+MBE_MATH_INLINE int mbe_floatBits(float x)
+{
+    int i;
+    memcpy(&i, &x, sizeof(i));
+    return i;
+}
+
+/// <summary>Reinterprets the bits of an integer as a float.</summary>
+MBE_MATH_INLINE float mbe_bitsFloat(int i)
+{
+    float x;
+    memcpy(&x, &i, sizeof(x));
+    return x;
+}
+
+/// <summary>Cosine of t turns; reduced to a quarter turn and evaluated with a degree 12 even polynomial.</summary>
+MBE_MATH_INLINE float mbe_cosTurns(double t)
+{
+    float a, s, x, z, r;
+
+    // reduce to [-0.5, 0.5] turns (rounding by the 1.5 * 2^52 shift, which avoids a floor()
+    // call), then fold to [0, 0.25] using cos(pi - x) = -cos(x)
+    t = t - ((t + 6755399441055744.0) - 6755399441055744.0);
+    a = fabsf((float)t);
+    s = (a > 0.25f) ? -1.0f : 1.0f;
+    a = (a > 0.25f) ? (0.5f - a) : a;
+
+    x = a * MBE_MATH_2PI;
+    z = x * x;
+    r = 1.0f + z * (-1.0f / 2.0f + z * (1.0f / 24.0f + z * (-1.0f / 720.0f + z * (1.0f / 40320.0f +
+        z * (-1.0f / 3628800.0f + z * (1.0f / 479001600.0f))))));
+    return s * r;
+}
+
+/// <summary>Cosine; the turn reduction is done in double as the synthesis phases grow large.</summary>
+MBE_MATH_INLINE float mbe_cosf(float x)
+{
+    return mbe_cosTurns((double)x * MBE_MATH_INV_2PI);
+}
+
+/// <summary>Sine, as a cosine a quarter turn back.</summary>
+MBE_MATH_INLINE float mbe_sinf(float x)
+{
+    return mbe_cosTurns(((double)x * MBE_MATH_INV_2PI) - 0.25);
+}
+
+/// <summary>Base 2 logarithm; exponent from the float bits, mantissa by an atanh series.</summary>
+MBE_MATH_INLINE float mbe_log2f(float x)
+{
+    int bits, e;
+    float m, s, z;
+
+    bits = mbe_floatBits(x);
+    e = ((bits >> 23) & 0xFF) - 127;
+    m = mbe_bitsFloat((bits & 0x007FFFFF) | 0x3F800000);
+
+    // centre the mantissa on 1 so |s| <= 0.1716
+    e = (m > 1.414213562f) ? (e + 1) : e;
+    m = (m > 1.414213562f) ? (m * 0.5f) : m;
+
+    s = (m - 1.0f) / (m + 1.0f);
+    z = s * s;
+    return (float)e + (2.0f * MBE_MATH_LOG2E) * s * (1.0f + z * (1.0f / 3.0f + z * (1.0f / 5.0f + z * (1.0f / 7.0f + z * (1.0f / 9.0f)))));
+}
+
+/// <summary>Base 2 exponential; integer part into the exponent bits, fraction by a degree 7 polynomial.</summary>
+MBE_MATH_INLINE float mbe_exp2f(float x)
+{
+    float i, f, r;
+
+    x = (x > 127.0f) ? 127.0f : x;
+    x = (x < -126.0f) ? -126.0f : x;
+
+    // round to nearest by the 1.5 * 2^23 shift
+    i = (x + 12582912.0f) - 12582912.0f;
+    f = (x - i) * MBE_MATH_LN2;
+    r = 1.0f + f * (1.0f + f * (1.0f / 2.0f + f * (1.0f / 6.0f + f * (1.0f / 24.0f + f * (1.0f / 120.0f +
+        f * (1.0f / 720.0f + f * (1.0f / 5040.0f)))))));
+    return r * mbe_bitsFloat(((int)i + 127) << 23);
+}
+
+/// <summary>Natural exponential.</summary>
+MBE_MATH_INLINE float mbe_expf(float x)
+{
+    return mbe_exp2f(x * MBE_MATH_LOG2E);
+}
+
+/// <summary>Reciprocal square root; bit estimate refined with two Newton steps.</summary>
+MBE_MATH_INLINE float mbe_rsqrtf(float x)
+{
+    float y = mbe_bitsFloat(0x5F3759DF - (mbe_floatBits(x) >> 1));
+    y = y * (1.5f - (0.5f * x * y * y));
+    y = y * (1.5f - (0.5f * x * y * y));
+    return y;
+}
+
+/// <summary>x to the power 0.25.</summary>
+MBE_MATH_INLINE float mbe_pow025f(float x)
+{
+    return sqrtf(sqrtf(x));
+}
+
+#else
+
+#define mbe_cosf(x)         cosf(x)
+#define mbe_sinf(x)         sinf(x)
+#define mbe_log2f(x)        log2f(x)
+#define mbe_exp2f(x)        powf(2, (x))
+#define mbe_expf(x)         exp(x)
+#define mbe_rsqrtf(x)       (1.0f / sqrtf(x))
+#define mbe_pow025f(x)      powf((x), (float)0.25)
+
+#endif // defined(MBE_FAST_MATH)
+
+#endif // __MBE_MATH_H__
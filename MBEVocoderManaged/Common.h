@@ -22,6 +22,7 @@ namespace vocoder
     public enum class MBEMode {
         DMRAMBE,
         IMBE,                   // e.g. IMBE used by P25
+        NXDNAMBE,
     };
 } // namespace vocoder
 
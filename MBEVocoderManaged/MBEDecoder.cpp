@@ -29,20 +29,23 @@ namespace vocoder
         static const int PCM_SAMPLES = 160;
         static const int AMBE_CODEWORD_SAMPLES = 9;
         static const int IMBE_CODEWORD_SAMPLES = 11;
+        static const int DMR_BURST_LENGTH_BYTES = 33;
 
         /// <summary>Initializes a new instance of the MBEDecoderManaged class.</summary>
         MBEDecoderManaged(MBEMode mode) :
             m_mode(mode)
         {
-            switch (mode) {
-            case MBEMode::DMRAMBE:
-                m_decoder = new vocoder::MBEDecoder(vocoder::DECODE_DMR_AMBE);
-                break;
-            case MBEMode::IMBE:
-            default:
-                m_decoder = new vocoder::MBEDecoder(vocoder::DECODE_88BIT_IMBE);
-                break;
+            m_decoder = new vocoder::MBEDecoder(decoderMode(mode));
+        }
+        /// <summary>Initializes a new instance of the MBEDecoderManaged class, streaming PCM at the given sample rate.</summary>
+        MBEDecoderManaged(MBEMode mode, int sampleRate) :
+            m_mode(mode)
+        {
+            if (sampleRate <= 0 || !::Resampler::isSupportedRate((uint32_t)sampleRate)) {
+                throw gcnew System::ArgumentOutOfRangeException("sampleRate is not 8000, 16000, 44100 or 48000");
             }
+
+            m_decoder = new vocoder::MBEDecoder(decoderMode(mode), (uint32_t)sampleRate);
         }
         /// <summary>Finalizes a instance of the MBEDecoderManaged class.</summary>
         ~MBEDecoderManaged()
@@ -64,48 +67,31 @@ namespace vocoder
             void set(bool value) { m_decoder->setAutoGain(value); }
         }
 
+        /// <summary>Gets the sample rate of PCM samples produced by decodeStream().</summary>
+        property int SampleRate
+        {
+            int get() { return (int)m_decoder->getSampleRate(); }
+        }
+
+        /// <summary>Gets the number of PCM samples decodeStream() produces for each codeword.</summary>
+        property int StreamSamples
+        {
+            int get() { return (int)m_decoder->getStreamSamples(); }
+        }
+
         /// <summary>Decodes the given MBE codewords to PCM samples using the decoder mode.</summary>
         Int32 decodeF(array<Byte>^ codeword, [Out] array<float>^% samples)
         {
             samples = nullptr;
 
-            if (codeword == nullptr) {
-                throw gcnew System::NullReferenceException("codeword");
-            }
-
-            // error check codeword length based on mode
-            switch (m_mode) {
-            case MBEMode::DMRAMBE:
-            {
-                if (codeword->Length > AMBE_CODEWORD_SAMPLES) {
-                    throw gcnew System::ArgumentOutOfRangeException("AMBE codeword length is > 9");
-                }
-
-                if (codeword->Length < AMBE_CODEWORD_SAMPLES) {
-                    throw gcnew System::ArgumentOutOfRangeException("AMBE codeword length is < 9");
-                }
-            }
-            break;
-            case MBEMode::IMBE:
-            default:
-            {
-                if (codeword->Length > IMBE_CODEWORD_SAMPLES) {
-                    throw gcnew System::ArgumentOutOfRangeException("IMBE codeword length is > 11");
-                }
-
-                if (codeword->Length < IMBE_CODEWORD_SAMPLES) {
-                    throw gcnew System::ArgumentOutOfRangeException("IMBE codeword length is < 11");
-                }
-            }
-            break;
-            }
+            checkCodeword(codeword);
 
             // pin codeword byte array and decode into PCM samples
             pin_ptr<Byte> ppCodeword = &codeword[0];
             uint8_t* pCodeword = ppCodeword;
 
             float pcmSamples[PCM_SAMPLES];
-            ::memset(pcmSamples, 0x00U, PCM_SAMPLES);
+            ::memset(pcmSamples, 0x00U, sizeof(pcmSamples));
             int errs = m_decoder->decodeF(pCodeword, pcmSamples);
 
             // copy decoded PCM samples into the managed array
@@ -124,13 +110,127 @@ namespace vocoder
         {
             samples = nullptr;
 
+            checkCodeword(codeword);
+
+            // pin codeword byte array and decode into PCM samples
+            pin_ptr<Byte> ppCodeword = &codeword[0];
+            uint8_t* pCodeword = ppCodeword;
+
+            int16_t pcmSamples[PCM_SAMPLES];
+            ::memset(pcmSamples, 0x00U, sizeof(pcmSamples));
+            int errs = m_decoder->decode(pCodeword, pcmSamples);
+
+            // copy decoded PCM samples into the managed array
+            samples = gcnew array<Int16>(PCM_SAMPLES);
+            pin_ptr<Int16> ppSamples = &samples[0];
+            for (int n = 0; n < PCM_SAMPLES; n++) {
+                *ppSamples = pcmSamples[n];
+                ppSamples++;
+            }
+
+            return errs;
+        }
+
+        /// <summary>Decodes the three AMBE frames of a DMR voice burst to PCM samples.</summary>
+        Int32 decodeDMRBurst(array<Byte>^ burst, [Out] array<Int16>^% samples, [Out] array<Int32>^% errs)
+        {
+            samples = nullptr;
+            errs = nullptr;
+
+            if (burst == nullptr) {
+                throw gcnew System::NullReferenceException("burst");
+            }
+
+            if (m_mode != MBEMode::DMRAMBE) {
+                throw gcnew System::InvalidOperationException("decoder is not in DMR AMBE mode");
+            }
+
+            if (burst->Length != DMR_BURST_LENGTH_BYTES) {
+                throw gcnew System::ArgumentOutOfRangeException("DMR burst length is not 33");
+            }
+
+            // pin burst byte array and decode into PCM samples
+            pin_ptr<Byte> ppBurst = &burst[0];
+            uint8_t* pBurst = ppBurst;
+
+            samples = gcnew array<Int16>(PCM_SAMPLES * 3);
+            pin_ptr<Int16> ppSamples = &samples[0];
+
+            vocoder::DMRBurstStats stats;
+            int totalErrs = m_decoder->decodeDMRBurst(pBurst, ppSamples, &stats);
+
+            errs = gcnew array<Int32>(3);
+            for (int n = 0; n < 3; n++) {
+                errs[n] = stats.m_errs[n];
+            }
+
+            return totalErrs;
+        }
+
+        /// <summary>Decodes the given MBE codewords to PCM samples at the stream sample rate.</summary>
+        Int32 decodeStream(array<Byte>^ codeword, [Out] array<Int16>^% samples)
+        {
+            samples = nullptr;
+            checkCodeword(codeword);
+
+            // pin codeword byte array and decode into PCM samples
+            pin_ptr<Byte> ppCodeword = &codeword[0];
+            uint8_t* pCodeword = ppCodeword;
+
+            samples = gcnew array<Int16>(m_decoder->getStreamSamples());
+            pin_ptr<Int16> ppSamples = &samples[0];
+            return m_decoder->decodeStream(pCodeword, ppSamples);
+        }
+
+        /// <summary>Decodes the given MBE codewords to float PCM samples at the stream sample rate.</summary>
+        Int32 decodeStream(array<Byte>^ codeword, [Out] array<float>^% samples)
+        {
+            samples = nullptr;
+            checkCodeword(codeword);
+
+            // pin codeword byte array and decode into PCM samples
+            pin_ptr<Byte> ppCodeword = &codeword[0];
+            uint8_t* pCodeword = ppCodeword;
+
+            samples = gcnew array<float>(m_decoder->getStreamSamples());
+            pin_ptr<float> ppSamples = &samples[0];
+            return m_decoder->decodeStreamF(pCodeword, ppSamples);
+        }
+
+        /// <summary>Discards resampler history of the stream decoder.</summary>
+        void resetStream()
+        {
+            m_decoder->resetStream();
+        }
+    private:
+        vocoder::MBEDecoder* m_decoder;
+        MBEMode m_mode;
+
+        /// <summary>Helper to return the native decoder mode for the given mode.</summary>
+        static vocoder::MBE_DECODER_MODE decoderMode(MBEMode mode)
+        {
+            switch (mode) {
+            case MBEMode::DMRAMBE:
+                return vocoder::DECODE_DMR_AMBE;
+            case MBEMode::NXDNAMBE:
+                return vocoder::DECODE_NXDN_AMBE;
+            case MBEMode::IMBE:
+            default:
+                return vocoder::DECODE_88BIT_IMBE;
+            }
+        }
+
+        /// <summary>Helper to error check the codeword length based on mode.</summary>
+        /// <remarks>Every decode call takes exactly one codeword; 9 bytes for AMBE modes and 11 bytes for IMBE.</remarks>
+        void checkCodeword(array<Byte>^ codeword)
+        {
             if (codeword == nullptr) {
                 throw gcnew System::NullReferenceException("codeword");
             }
 
-            // error check codeword length based on mode
             switch (m_mode) {
             case MBEMode::DMRAMBE:
+            case MBEMode::NXDNAMBE:
             {
                 if (codeword->Length > AMBE_CODEWORD_SAMPLES) {
                     throw gcnew System::ArgumentOutOfRangeException("AMBE codeword length is > 9");
@@ -154,27 +254,6 @@ namespace vocoder
             }
             break;
             }
-
-            // pin codeword byte array and decode into PCM samples
-            pin_ptr<Byte> ppCodeword = &codeword[0];
-            uint8_t* pCodeword = ppCodeword;
-
-            int16_t pcmSamples[PCM_SAMPLES];
-            ::memset(pcmSamples, 0x00U, PCM_SAMPLES);
-            int errs = m_decoder->decode(pCodeword, pcmSamples);
-
-            // copy decoded PCM samples into the managed array
-            samples = gcnew array<Int16>(PCM_SAMPLES);
-            pin_ptr<Int16> ppSamples = &samples[0];
-            for (int n = 0; n < PCM_SAMPLES; n++) {
-                *ppSamples = pcmSamples[n];
-                ppSamples++;
-            }
-
-            return errs;
         }
-    private:
-        vocoder::MBEDecoder* m_decoder;
-        MBEMode m_mode;
     };
 } // namespace vocoder
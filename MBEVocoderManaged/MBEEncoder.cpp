@@ -34,15 +34,17 @@ namespace vocoder
         MBEEncoderManaged(MBEMode mode) :
             m_mode(mode)
         {
-            switch (mode) {
-            case MBEMode::DMRAMBE:
-                m_encoder = new vocoder::MBEEncoder(vocoder::ENCODE_DMR_AMBE);
-                break;
-            case MBEMode::IMBE:
-            default:
-                m_encoder = new vocoder::MBEEncoder(vocoder::ENCODE_88BIT_IMBE);
-                break;
+            m_encoder = new vocoder::MBEEncoder(encoderMode(mode));
+        }
+        /// <summary>Initializes a new instance of the MBEEncoderManaged class, streaming PCM at the given sample rate.</summary>
+        MBEEncoderManaged(MBEMode mode, int sampleRate) :
+            m_mode(mode)
+        {
+            if (sampleRate <= 0 || !::Resampler::isSupportedRate((uint32_t)sampleRate)) {
+                throw gcnew System::ArgumentOutOfRangeException("sampleRate is not 8000, 16000, 44100 or 48000");
             }
+
+            m_encoder = new vocoder::MBEEncoder(encoderMode(mode), (uint32_t)sampleRate);
         }
         /// <summary>Finalizes a instance of the MBEEncoderManaged class.</summary>
         ~MBEEncoderManaged()
@@ -77,7 +79,7 @@ namespace vocoder
 
             // pin samples array and encode into codewords
             int16_t pcmSamples[PCM_SAMPLES];
-            ::memset(pcmSamples, 0x00U, PCM_SAMPLES);
+            ::memset(pcmSamples, 0x00U, sizeof(pcmSamples));
             pin_ptr<Int16> ppSamples = &samples[0];
             for (int n = 0; n < PCM_SAMPLES; n++) {
                 pcmSamples[n] = samples[n];
@@ -86,6 +88,7 @@ namespace vocoder
             // encode samples
             switch (m_mode) {
             case MBEMode::DMRAMBE:
+            case MBEMode::NXDNAMBE:
             {
                 uint8_t codewords[AMBE_CODEWORD_SAMPLES];
                 m_encoder->encode(pcmSamples, codewords);
@@ -117,8 +120,94 @@ namespace vocoder
             }
         }
 
+        /// <summary>Adds PCM samples at the stream sample rate and encodes every complete frame to MBE codewords.</summary>
+        /// <remarks>Returns the number of codewords; codewords holds them back to back, CodewordLength bytes each.</remarks>
+        Int32 encodeStream(array<Int16>^ samples, int offset, int count, [Out] array<Byte>^% codewords)
+        {
+            codewords = nullptr;
+            checkRange(samples, offset, count);
+
+            uint32_t frames = m_encoder->getStreamCodewords((uint32_t)count);
+            codewords = gcnew array<Byte>(frames * m_encoder->getCodewordLength());
+            if (count == 0 && frames == 0U)
+                return 0;
+
+            pin_ptr<Int16> ppSamples = nullptr;
+            if (count > 0)
+                ppSamples = &samples[offset];
+            pin_ptr<Byte> ppCodewords = nullptr;
+            if (frames > 0U)
+                ppCodewords = &codewords[0];
+            return m_encoder->encodeStream(ppSamples, (uint32_t)count, ppCodewords, frames);
+        }
+
+        /// <summary>Adds float PCM samples at the stream sample rate and encodes every complete frame to MBE codewords.</summary>
+        /// <remarks>Returns the number of codewords; codewords holds them back to back, CodewordLength bytes each.</remarks>
+        Int32 encodeStream(array<float>^ samples, int offset, int count, [Out] array<Byte>^% codewords)
+        {
+            codewords = nullptr;
+            checkRange(samples, offset, count);
+
+            uint32_t frames = m_encoder->getStreamCodewords((uint32_t)count);
+            codewords = gcnew array<Byte>(frames * m_encoder->getCodewordLength());
+            if (count == 0 && frames == 0U)
+                return 0;
+
+            pin_ptr<float> ppSamples = nullptr;
+            if (count > 0)
+                ppSamples = &samples[offset];
+            pin_ptr<Byte> ppCodewords = nullptr;
+            if (frames > 0U)
+                ppCodewords = &codewords[0];
+            return m_encoder->encodeStreamF(ppSamples, (uint32_t)count, ppCodewords, frames);
+        }
+
+        /// <summary>Discards buffered samples and resampler history of the stream encoder.</summary>
+        void resetStream()
+        {
+            m_encoder->resetStream();
+        }
+
+        /// <summary>Gets the sample rate of PCM samples given to encodeStream().</summary>
+        property int SampleRate
+        {
+            int get() { return (int)m_encoder->getSampleRate(); }
+        }
+
+        /// <summary>Gets the length in bytes of each codeword produced by encodeStream().</summary>
+        property int CodewordLength
+        {
+            int get() { return (int)m_encoder->getCodewordLength(); }
+        }
+
     private:
         vocoder::MBEEncoder* m_encoder;
         MBEMode m_mode;
+
+        /// <summary>Helper to return the native encoder mode for the given mode.</summary>
+        static vocoder::MBE_ENCODER_MODE encoderMode(MBEMode mode)
+        {
+            switch (mode) {
+            case MBEMode::DMRAMBE:
+                return vocoder::ENCODE_DMR_AMBE;
+            case MBEMode::NXDNAMBE:
+                return vocoder::ENCODE_NXDN_AMBE;
+            case MBEMode::IMBE:
+            default:
+                return vocoder::ENCODE_88BIT_IMBE;
+            }
+        }
+
+        /// <summary>Helper to check an offset and sample count lie within a managed array.</summary>
+        static void checkRange(Array^ samples, int offset, int count)
+        {
+            if (samples == nullptr) {
+                throw gcnew System::NullReferenceException("samples");
+            }
+
+            if (offset < 0 || count < 0 || offset > samples->Length - count) {
+                throw gcnew System::ArgumentOutOfRangeException("samples");
+            }
+        }
     };
 } // namespace vocoder
@@ -42,6 +42,10 @@ namespace vocoder
                 m_decoder = new vocoder::MBEDecoder(vocoder::DECODE_DMR_AMBE);
                 m_encoder = new vocoder::MBEEncoder(vocoder::ENCODE_DMR_AMBE);
                 break;
+            case MBEMode::NXDNAMBE:
+                m_decoder = new vocoder::MBEDecoder(vocoder::DECODE_NXDN_AMBE);
+                m_encoder = new vocoder::MBEEncoder(vocoder::ENCODE_NXDN_AMBE);
+                break;
             case MBEMode::IMBE:
             default:
                 m_decoder = new vocoder::MBEDecoder(vocoder::DECODE_88BIT_IMBE);
@@ -70,6 +74,7 @@ namespace vocoder
             // error check codeword length based on mode
             switch (m_mode) {
             case MBEMode::DMRAMBE:
+            case MBEMode::NXDNAMBE:
             {
                 if (codeword->Length > AMBE_CODEWORD_SAMPLES) {
                     throw gcnew System::ArgumentOutOfRangeException("AMBE codeword length is > 9");
@@ -108,6 +113,7 @@ namespace vocoder
 
             switch (m_mode) {
             case MBEMode::DMRAMBE:
+            case MBEMode::NXDNAMBE:
             {
                 // copy decoded MBE bits into the managed array
                 mbeBits = gcnew array<Byte>(AMBE_CODEWORD_BITS);
@@ -150,6 +156,7 @@ namespace vocoder
             // error check codeword length based on mode
             switch (m_mode) {
             case MBEMode::DMRAMBE:
+            case MBEMode::NXDNAMBE:
             {
                 if (mbeBits->Length > AMBE_CODEWORD_BITS) {
                     throw gcnew System::ArgumentOutOfRangeException("AMBE codeword length is > 49");
@@ -189,6 +196,7 @@ namespace vocoder
             // encode samples
             switch (m_mode) {
             case MBEMode::DMRAMBE:
+            case MBEMode::NXDNAMBE:
             {
                 uint8_t codewords[AMBE_CODEWORD_SAMPLES];
                 m_encoder->encodeBits(bits, codewords);
@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/**
+* Digital Voice Modem - MBE Vocoder
+* GPLv2 Open Source. Use is subject to license terms.
+* DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+*
+* @package DVM / MBE Vocoder
+* @license GPLv2 License (https://opensource.org/licenses/GPL-2.0)
+*
+*/
+#include "PCMOps.h"
+#include "Common.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace vocoder
+{
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    //      Implements whole-buffer PCM sample conversion, gain and metering
+    //      over managed arrays.
+    // ---------------------------------------------------------------------------
+
+    public ref class PCMOpsManaged
+    {
+    public:
+        /// <summary>Converts PCM bytes to 16-bit samples, applying a gain.</summary>
+        static void bytesToSamples(array<Byte>^ pcm, int pcmOffset, array<Int16>^ samples, int offset, int count, float gain)
+        {
+            checkRange(pcm, "pcm", pcmOffset, count * 2);
+            checkRange(samples, "samples", offset, count);
+            if (count == 0)
+                return;
+
+            pin_ptr<Byte> ppPCM = &pcm[pcmOffset];
+            pin_ptr<Int16> ppSamples = &samples[offset];
+            ::PCMOps::bytesToSamples(ppPCM, ppSamples, (uint32_t)count, gain);
+        }
+
+        /// <summary>Converts 16-bit samples to PCM bytes, applying a gain.</summary>
+        static void samplesToBytes(array<Int16>^ samples, int offset, array<Byte>^ pcm, int pcmOffset, int count, float gain)
+        {
+            checkRange(samples, "samples", offset, count);
+            checkRange(pcm, "pcm", pcmOffset, count * 2);
+            if (count == 0)
+                return;
+
+            pin_ptr<Int16> ppSamples = &samples[offset];
+            pin_ptr<Byte> ppPCM = &pcm[pcmOffset];
+            ::PCMOps::samplesToBytes(ppSamples, ppPCM, (uint32_t)count, gain);
+        }
+
+        /// <summary>Converts 16-bit samples to float samples, applying a gain.</summary>
+        static void samplesToFloat(array<Int16>^ samples, int offset, array<float>^ samplesF, int offsetF, int count, float gain)
+        {
+            checkRange(samples, "samples", offset, count);
+            checkRange(samplesF, "samplesF", offsetF, count);
+            if (count == 0)
+                return;
+
+            pin_ptr<Int16> ppSamples = &samples[offset];
+            pin_ptr<float> ppSamplesF = &samplesF[offsetF];
+            ::PCMOps::samplesToFloat(ppSamples, ppSamplesF, (uint32_t)count, gain);
+        }
+
+        /// <summary>Converts float samples to 16-bit samples, applying a gain.</summary>
+        static void floatToSamples(array<float>^ samplesF, int offsetF, array<Int16>^ samples, int offset, int count, float gain)
+        {
+            checkRange(samplesF, "samplesF", offsetF, count);
+            checkRange(samples, "samples", offset, count);
+            if (count == 0)
+                return;
+
+            pin_ptr<float> ppSamplesF = &samplesF[offsetF];
+            pin_ptr<Int16> ppSamples = &samples[offset];
+            ::PCMOps::floatToSamples(ppSamplesF, ppSamples, (uint32_t)count, gain);
+        }
+
+        /// <summary>Returns the peak level of 16-bit samples, scaled to 1.0.</summary>
+        static float peakLevel(array<Int16>^ samples, int offset, int count)
+        {
+            checkRange(samples, "samples", offset, count);
+            if (count == 0)
+                return 0.0f;
+
+            pin_ptr<Int16> ppSamples = &samples[offset];
+            return ::PCMOps::peakLevel(ppSamples, (uint32_t)count);
+        }
+
+        /// <summary>Returns the peak and RMS level of 16-bit samples, scaled to 1.0.</summary>
+        static void measureLevel(array<Int16>^ samples, int offset, int count, [Out] float% peak, [Out] float% rms)
+        {
+            peak = 0.0f;
+            rms = 0.0f;
+
+            checkRange(samples, "samples", offset, count);
+            if (count == 0)
+                return;
+
+            float p = 0.0f, r = 0.0f;
+            pin_ptr<Int16> ppSamples = &samples[offset];
+            ::PCMOps::measureLevel(ppSamples, (uint32_t)count, p, r);
+
+            peak = p;
+            rms = r;
+        }
+
+        /// <summary>Returns true if the peak level of 16-bit samples exceeds the VOX threshold.</summary>
+        static bool detectVOX(array<Int16>^ samples, int offset, int count, float threshold)
+        {
+            checkRange(samples, "samples", offset, count);
+            if (count == 0)
+                return false;
+
+            pin_ptr<Int16> ppSamples = &samples[offset];
+            return ::PCMOps::detectVOX(ppSamples, (uint32_t)count, threshold);
+        }
+
+    private:
+        /// <summary>Helper to check an offset and element count lie within a managed array.</summary>
+        static void checkRange(Array^ buffer, String^ name, int offset, int count)
+        {
+            if (buffer == nullptr) {
+                throw gcnew System::NullReferenceException(name);
+            }
+
+            if (offset < 0 || count < 0 || offset > buffer->Length - count) {
+                throw gcnew System::ArgumentOutOfRangeException(name);
+            }
+        }
+    };
+} // namespace vocoder
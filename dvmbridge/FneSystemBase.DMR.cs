@@ -21,8 +21,6 @@ using Serilog;
 using fnecore;
 using fnecore.DMR;
 
-using NAudio.Wave;
-
 using vocoder;
 
 namespace dvmbridge
@@ -134,8 +132,7 @@ namespace dvmbridge
                 for (int n = 0; n < AMBE_PER_SLOT; n++)
                 {
                     byte[] ambePartial = new byte[AMBE_BUF_LEN];
-                    for (int i = 0; i < AMBE_BUF_LEN; i++)
-                        ambePartial[i] = ambeBuffer[i + (n * 9)];
+                    Buffer.BlockCopy(ambeBuffer, n * 9, ambePartial, 0, AMBE_BUF_LEN);
 
                     short[] samp = null;
                     int errs = dmrDecoder.decode(ambePartial, out samp);
@@ -144,14 +141,8 @@ namespace dvmbridge
                         Log.Logger.Debug($"LOOPBACK_TEST PARTIAL AMBE {FneUtils.HexDump(ambePartial)}");
                         Log.Logger.Debug($"LOOPBACK_TEST SAMPLE BUFFER {FneUtils.HexDump(samp)}");
 
-                        int pcmIdx = 0;
                         byte[] pcm2 = new byte[samp.Length * 2];
-                        for (int smpIdx2 = 0; smpIdx2 < samp.Length; smpIdx2++)
-                        {
-                            pcm2[pcmIdx + 0] = (byte)(samp[smpIdx2] & 0xFF);
-                            pcm2[pcmIdx + 1] = (byte)((samp[smpIdx2] >> 8) & 0xFF);
-                            pcmIdx += 2;
-                        }
+                        PCMOpsManaged.samplesToBytes(samp, 0, pcm2, 0, samp.Length, 1.0f);
 
                         Log.Logger.Debug($"LOOPBACK_TEST BYTE BUFFER {FneUtils.HexDump(pcm)}");
                         waveProvider.AddSamples(pcm2, 0, pcm2.Length);
@@ -244,24 +235,9 @@ namespace dvmbridge
 #endif
             // Log.Logger.Debug($"BYTE BUFFER {FneUtils.HexDump(pcm)}");
 
-            // pre-process: apply gain to PCM audio frames
-            if (Program.Configuration.TxAudioGain != 1.0f)
-            {
-                BufferedWaveProvider buffer = new BufferedWaveProvider(waveFormat);
-                buffer.AddSamples(pcm, 0, pcm.Length);
-
-                VolumeWaveProvider16 gainControl = new VolumeWaveProvider16(buffer);
-                gainControl.Volume = Program.Configuration.TxAudioGain;
-                gainControl.Read(pcm, 0, pcm.Length);
-            }
-
-            int smpIdx = 0;
+            // convert PCM audio frames to samples, applying gain
             short[] samples = new short[MBE_SAMPLES_LENGTH];
-            for (int pcmIdx = 0; pcmIdx < pcm.Length; pcmIdx += 2)
-            {
-                samples[smpIdx] = (short)((pcm[pcmIdx + 1] << 8) + pcm[pcmIdx + 0]);
-                smpIdx++;
-            }
+            PCMOpsManaged.bytesToSamples(pcm, 0, samples, 0, Math.Min(pcm.Length / 2, MBE_SAMPLES_LENGTH), Program.Configuration.TxAudioGain);
 
             // Log.Logger.Debug($"SAMPLE BUFFER {FneUtils.HexDump(samples)}");
 
@@ -281,58 +257,77 @@ namespace dvmbridge
             ambeCount++;
         }
 
+#if WIN32
+        /// <summary>
+        /// Helper to extract a single AMBE frame from a DMR voice burst.
+        /// </summary>
+        /// <param name="data"></param>
+        /// <param name="n"></param>
+        /// <returns></returns>
+        private static byte[] DMRGetAMBEFrame(byte[] data, int n)
+        {
+            byte[] ambe = new byte[AMBE_BUF_LEN];
+            switch (n)
+            {
+                case 0:
+                    Buffer.BlockCopy(data, 0, ambe, 0, AMBE_BUF_LEN);
+                    break;
+                case 1:
+                    Buffer.BlockCopy(data, 9, ambe, 0, 4);
+                    ambe[4] = (byte)((data[13] & 0xF0) | (data[19] & 0x0F));
+                    Buffer.BlockCopy(data, 20, ambe, 5, 4);
+                    break;
+                default:
+                    Buffer.BlockCopy(data, 24, ambe, 0, AMBE_BUF_LEN);
+                    break;
+            }
+
+            return ambe;
+        }
+#endif
+
         /// <summary>
         /// Helper to decode and playback DMR AMBE frames as PCM audio.
         /// </summary>
-        /// <param name="ambe"></param>
+        /// <param name="data">DMR voice burst</param>
         /// <param name="e"></param>
-        private void DMRDecodeAudioFrame(byte[] ambe, DMRDataReceivedEvent e)
+        private void DMRDecodeAudioFrame(byte[] data, DMRDataReceivedEvent e)
         {
             try
             {
-                // Log.Logger.Debug($"FULL AMBE {FneUtils.HexDump(ambe)}");
+                // decode all three AMBE frames of the burst in one native call
+                short[] burstSamples = null;
+                int[] burstErrs = null;
+#if WIN32
+                if (extHalfRateVocoder == null)
+                    dmrDecoder.decodeDMRBurst(data, out burstSamples, out burstErrs);
+#else
+                dmrDecoder.decodeDMRBurst(data, out burstSamples, out burstErrs);
+#endif
+
                 for (int n = 0; n < AMBE_PER_SLOT; n++)
                 {
-                    byte[] ambePartial = new byte[AMBE_BUF_LEN];
-                    for (int i = 0; i < AMBE_BUF_LEN; i++)
-                        ambePartial[i] = ambe[i + (n * 9)];
-
-                    short[] samples = null;
+                    short[] samples = burstSamples;
+                    int sampleOffset = n * MBE_SAMPLES_LENGTH;
                     int errs = 0;
+                    if (burstErrs != null)
+                        errs = burstErrs[n];
 #if WIN32
                     if (extHalfRateVocoder != null)
-                        errs = extHalfRateVocoder.decode(ambePartial, out samples);
-                    else
-                        errs = dmrDecoder.decode(ambePartial, out samples);
-#else
-                    errs = dmrDecoder.decode(ambePartial, out samples);
+                    {
+                        errs = extHalfRateVocoder.decode(DMRGetAMBEFrame(data, n), out samples);
+                        sampleOffset = 0;
+                    }
 #endif
 
                     if (samples != null)
                     {
                         Log.Logger.Information($"({SystemName}) DMRD: Traffic *VOICE FRAME    * PEER {e.PeerId} SRC_ID {e.SrcId} TGID {e.DstId} TS {e.Slot + 1} VC{e.n}.{n} ERRS {errs} [STREAM ID {e.StreamId}]");
-                        // Log.Logger.Debug($"PARTIAL AMBE {FneUtils.HexDump(ambePartial)}");
                         // Log.Logger.Debug($"SAMPLE BUFFER {FneUtils.HexDump(samples)}");
 
-                        int pcmIdx = 0;
-                        byte[] pcm = new byte[samples.Length * 2];
-                        for (int smpIdx = 0; smpIdx < samples.Length; smpIdx++)
-                        {
-                            pcm[pcmIdx + 0] = (byte)(samples[smpIdx] & 0xFF);
-                            pcm[pcmIdx + 1] = (byte)((samples[smpIdx] >> 8) & 0xFF);
-                            pcmIdx += 2;
-                        }
-
-                        // post-process: apply gain to decoded audio frames
-                        if (Program.Configuration.RxAudioGain != 1.0f)
-                        {
-                            BufferedWaveProvider buffer = new BufferedWaveProvider(waveFormat);
-                            buffer.AddSamples(pcm, 0, pcm.Length);
-
-                            VolumeWaveProvider16 gainControl = new VolumeWaveProvider16(buffer);
-                            gainControl.Volume = Program.Configuration.RxAudioGain;
-                            gainControl.Read(pcm, 0, pcm.Length);
-                        }
+                        // convert decoded samples to PCM audio frames, applying gain
+                        byte[] pcm = new byte[MBE_SAMPLES_LENGTH * 2];
+                        PCMOpsManaged.samplesToBytes(samples, sampleOffset, pcm, 0, MBE_SAMPLES_LENGTH, Program.Configuration.RxAudioGain);
 
                         // Log.Logger.Debug($"PCM BYTE BUFFER {FneUtils.HexDump(pcm)}");
                         if (Program.Configuration.LocalAudio)
@@ -345,15 +340,13 @@ namespace dvmbridge
                             {
                                 audioData = new byte[pcm.Length + 4]; // PCM + 4 bytes (PCM length)
                                 FneUtils.WriteBytes(pcm.Length, ref audioData, 0);
-                                for (int idx = 0; idx < pcm.Length; idx++)
-                                    audioData[idx + 4] = pcm[idx];
+                                Buffer.BlockCopy(pcm, 0, audioData, 4, pcm.Length);
                             }
                             else
                             {
                                 audioData = new byte[pcm.Length + 12]; // PCM + (4 bytes (PCM length) + 4 bytes (srcId) + 4 bytes (dstId))
                                 FneUtils.WriteBytes(pcm.Length, ref audioData, 0);
-                                for (int idx = 0; idx < pcm.Length; idx++)
-                                    audioData[idx + 4] = pcm[idx];
+                                Buffer.BlockCopy(pcm, 0, audioData, 4, pcm.Length);
 
                                 // embed destination ID
                                 FneUtils.WriteBytes(e.DstId, ref audioData, pcm.Length + 4);
@@ -448,12 +441,7 @@ namespace dvmbridge
 
                 if (e.FrameType == FrameType.VOICE_SYNC || e.FrameType == FrameType.VOICE)
                 {
-                    byte[] ambe = new byte[DMR_AMBE_LENGTH_BYTES];
-                    Buffer.BlockCopy(data, 0, ambe, 0, 14);
-                    ambe[13] &= 0xF0;
-                    ambe[13] |= (byte)(data[19] & 0x0F);
-                    Buffer.BlockCopy(data, 20, ambe, 14, 13);
-                    DMRDecodeAudioFrame(ambe, e);
+                    DMRDecodeAudioFrame(data, e);
                 }
 
                 status[e.Slot].RxRFS = e.SrcId;
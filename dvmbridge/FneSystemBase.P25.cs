@@ -21,8 +21,6 @@ using Serilog;
 using fnecore;
 using fnecore.P25;
 
-using NAudio.Wave;
-
 using vocoder;
 using System.Windows.Forms;
 
@@ -481,24 +479,9 @@ namespace dvmbridge
 
             // Log.Logger.Debug($"BYTE BUFFER {FneUtils.HexDump(pcm)}");
 
-            // pre-process: apply gain to PCM audio frames
-            if (Program.Configuration.TxAudioGain != 1.0f)
-            {
-                BufferedWaveProvider buffer = new BufferedWaveProvider(waveFormat);
-                buffer.AddSamples(pcm, 0, pcm.Length);
-
-                VolumeWaveProvider16 gainControl = new VolumeWaveProvider16(buffer);
-                gainControl.Volume = Program.Configuration.TxAudioGain;
-                gainControl.Read(pcm, 0, pcm.Length);
-            }
-
-            int smpIdx = 0;
+            // convert PCM audio frames to samples, applying gain
             short[] samples = new short[MBE_SAMPLES_LENGTH];
-            for (int pcmIdx = 0; pcmIdx < pcm.Length; pcmIdx += 2)
-            {
-                samples[smpIdx] = (short)((pcm[pcmIdx + 1] << 8) + pcm[pcmIdx + 0]);
-                smpIdx++;
-            }
+            PCMOpsManaged.bytesToSamples(pcm, 0, samples, 0, Math.Min(pcm.Length / 2, MBE_SAMPLES_LENGTH), Program.Configuration.TxAudioGain);
 
             // Log.Logger.Debug($"SAMPLE BUFFER {FneUtils.HexDump(samples)}");
 
@@ -521,14 +504,8 @@ namespace dvmbridge
                 Log.Logger.Debug($"LOOPBACK_TEST IMBE {FneUtils.HexDump(imbe)}");
                 Log.Logger.Debug($"LOOPBACK_TEST SAMPLE BUFFER {FneUtils.HexDump(samp2)}");
 
-                int pcmIdx = 0;
                 byte[] pcm2 = new byte[samp2.Length * 2];
-                for (int smpIdx2 = 0; smpIdx2 < samp2.Length; smpIdx2++)
-                {
-                    pcm2[pcmIdx + 0] = (byte)(samp2[smpIdx2] & 0xFF);
-                    pcm2[pcmIdx + 1] = (byte)((samp2[smpIdx2] >> 8) & 0xFF);
-                    pcmIdx += 2;
-                }
+                PCMOpsManaged.samplesToBytes(samp2, 0, pcm2, 0, samp2.Length, 1.0f);
 
                 Log.Logger.Debug($"LOOPBACK_TEST BYTE BUFFER {FneUtils.HexDump(pcm2)}");
                 waveProvider.AddSamples(pcm2, 0, pcm2.Length);
@@ -714,26 +691,9 @@ namespace dvmbridge
                         // Log.Logger.Debug($"IMBE {FneUtils.HexDump(imbe)}");
                         // Log.Logger.Debug($"SAMPLE BUFFER {FneUtils.HexDump(samples)}");
 
-                        int pcmIdx = 0;
+                        // convert decoded samples to PCM audio frames, applying gain
                         byte[] pcm = new byte[samples.Length * 2];
-
-                        for (int smpIdx = 0; smpIdx < samples.Length; smpIdx++)
-                        {
-                            pcm[pcmIdx + 0] = (byte)(samples[smpIdx] & 0xFF);
-                            pcm[pcmIdx + 1] = (byte)((samples[smpIdx] >> 8) & 0xFF);
-                            pcmIdx += 2;
-                        }
-
-                        // post-process: apply gain to decoded audio frames
-                        if (Program.Configuration.RxAudioGain != 1.0f)
-                        {
-                            BufferedWaveProvider buffer = new BufferedWaveProvider(waveFormat);
-                            buffer.AddSamples(pcm, 0, pcm.Length);
-
-                            VolumeWaveProvider16 gainControl = new VolumeWaveProvider16(buffer);
-                            gainControl.Volume = Program.Configuration.RxAudioGain;
-                            gainControl.Read(pcm, 0, pcm.Length);
-                        }
+                        PCMOpsManaged.samplesToBytes(samples, 0, pcm, 0, samples.Length, Program.Configuration.RxAudioGain);
 
                         // Log.Logger.Debug($"PCM BYTE BUFFER {FneUtils.HexDump(pcm)}");
                         if (Program.Configuration.LocalAudio)
@@ -746,15 +706,13 @@ namespace dvmbridge
                             {
                                 audioData = new byte[pcm.Length + 4]; // PCM + 4 bytes (PCM length)
                                 FneUtils.WriteBytes(pcm.Length, ref audioData, 0);
-                                for (int idx = 0; idx < pcm.Length; idx++)
-                                    audioData[idx + 4] = pcm[idx];
+                                Buffer.BlockCopy(pcm, 0, audioData, 4, pcm.Length);
                             }
                             else
                             {
                                 audioData = new byte[pcm.Length + 12]; // PCM + (4 bytes (PCM length) + 4 bytes (srcId) + 4 bytes (dstId))
                                 FneUtils.WriteBytes(pcm.Length, ref audioData, 0);
-                                for (int idx = 0; idx < pcm.Length; idx++)
-                                    audioData[idx + 4] = pcm[idx];
+                                Buffer.BlockCopy(pcm, 0, audioData, 4, pcm.Length);
 
                                 // embed destination ID
                                 FneUtils.WriteBytes(e.DstId, ref audioData, pcm.Length + 4);
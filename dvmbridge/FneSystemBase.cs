@@ -138,6 +138,8 @@ namespace dvmbridge
         private const int AFSK_AUDIO_BUFFER_MS = 60;
         private const int AFSK_AUDIO_NO_BUFFERS = 4;
 
+        private const int METER_SAMPLES_PER_NOTIFICATION = SAMPLE_RATE / 20;
+
         private const int TX_MODE_DMR = 1;
         private const int TX_MODE_P25 = 2;
 
@@ -162,9 +164,9 @@ namespace dvmbridge
         bool audioDetect;
         bool trafficFromUdp;
 
-        private BufferedWaveProvider meterInternalBuffer;
-        private SampleChannel sampleChannel;
-        private MeteringSampleProvider meterProvider;
+        private short[] meterSamples;
+        private int meterSampleCount;
+        private float meterMaxSample;
 
         private WaveOut waveOut;
 
@@ -279,12 +281,9 @@ namespace dvmbridge
 
             this.waveFormat = new WaveFormat(SAMPLE_RATE, BITS_PER_SECOND, 1);
 
-            this.meterInternalBuffer = new BufferedWaveProvider(waveFormat);
-            this.meterInternalBuffer.DiscardOnBufferOverflow = true;
-
-            this.sampleChannel = new SampleChannel(meterInternalBuffer);
-            this.meterProvider = new MeteringSampleProvider(sampleChannel);
-            this.meterProvider.StreamVolume += MeterProvider_StreamVolume;
+            this.meterSamples = new short[MBE_SAMPLES_LENGTH];
+            this.meterSampleCount = 0;
+            this.meterMaxSample = 0.0f;
 
             // initialize the output audio provider
             if (Program.WaveOutDevice != -1)
@@ -385,11 +384,45 @@ namespace dvmbridge
         }
 
         /// <summary>
-        /// Event that occurs when wave audio is detected.
+        /// Helper to meter PCM audio, checking the volume for every 50ms of samples.
         /// </summary>
-        /// <param name="sender"></param>
-        /// <param name="e"></param>
-        private void MeterProvider_StreamVolume(object sender, StreamVolumeEventArgs e)
+        /// <param name="pcm"></param>
+        /// <param name="length"></param>
+        private void MeterAudio(byte[] pcm, int length)
+        {
+            int count = length / 2;
+            if (meterSamples.Length < count)
+                meterSamples = new short[count];
+
+            PCMOpsManaged.bytesToSamples(pcm, 0, meterSamples, 0, count, 1.0f);
+
+            // the peak level carries across buffers until a full notification window is metered
+            int offset = 0;
+            while (offset < count)
+            {
+                int len = Math.Min(count - offset, METER_SAMPLES_PER_NOTIFICATION - meterSampleCount);
+
+                float peak = PCMOpsManaged.peakLevel(meterSamples, offset, len);
+                if (peak > meterMaxSample)
+                    meterMaxSample = peak;
+
+                offset += len;
+                meterSampleCount += len;
+                if (meterSampleCount == METER_SAMPLES_PER_NOTIFICATION)
+                {
+                    Meter_StreamVolume(meterMaxSample);
+
+                    meterSampleCount = 0;
+                    meterMaxSample = 0.0f;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Event that occurs when wave audio is metered.
+        /// </summary>
+        /// <param name="maxSampleValue"></param>
+        private void Meter_StreamVolume(float maxSampleValue)
         {
             float sampleLevel = Program.Configuration.VoxSampleLevel / 1000;
 
@@ -408,7 +441,7 @@ namespace dvmbridge
             }
 
             // handle Rx triggered by internal VOX
-            if (e.MaxSampleValues[0] > sampleLevel)
+            if (maxSampleValue > sampleLevel)
             {
                 audioDetect = true;
                 if (txStreamId == 0)
@@ -481,12 +514,8 @@ namespace dvmbridge
                 int samples = SampleTimeConvert.MSToSampleBytes(waveFormat, AUDIO_BUFFER_MS);
                 if (e.BytesRecorded == samples)
                 {
-                    // add samples to the metering buffer
-                    meterInternalBuffer.AddSamples(e.Buffer, 0, e.BytesRecorded);
-
-                    // trigger readback of metering buffer
-                    float[] temp = new float[meterInternalBuffer.BufferedBytes];
-                    this.meterProvider.Read(temp, 0, temp.Length);
+                    // meter samples to check volume
+                    MeterAudio(e.Buffer, e.BytesRecorded);
 
                     if (audioDetect && !callInProgress)
                     {
@@ -516,8 +545,7 @@ namespace dvmbridge
 
                 int pcmLength = FneUtils.ToInt32(receivedData, 0);
                 byte[] pcm = new byte[pcmLength];
-                for (int idx = 0; idx < pcmLength; idx++)
-                    pcm[idx] = receivedData[idx + 4];
+                Buffer.BlockCopy(receivedData, 4, pcm, 0, pcmLength);
 
                 // Log.Logger.Debug($"PCM RECV BYTE BUFFER {FneUtils.HexDump(pcm)}");
 
@@ -530,12 +558,8 @@ namespace dvmbridge
 
                 udpDstId = (uint)Program.Configuration.DestinationId;
 
-                // add audio samples to the metering buffer
-                meterInternalBuffer.AddSamples(pcm, 0, pcm.Length);
-
-                // read back metering buffer to check volume
-                float[] temp = new float[meterInternalBuffer.BufferedBytes];
-                meterProvider.Read(temp, 0, temp.Length);
+                // meter audio samples to check volume
+                MeterAudio(pcm, pcm.Length);
 
                 trafficFromUdp = true;
 